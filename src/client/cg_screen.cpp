@@ -17,6 +17,7 @@ Handles rendering of numerical stats (health, armor, ammo) using custom graphica
 #include <sstream>  // for std::istringstream
 #include <string>   // for std::string
 #include <string_view> // for std::string_view
+#include <unordered_map> // for std::unordered_map
 
 #include <cassert>     // for assert
 #define Q_MIN(a, b) ((a) < (b) ? (a) : (b))  // safe min macro
@@ -64,6 +65,172 @@ static struct {
 
 #include <vector>
 
+/*
+=============================================================================
+
+TEXT LAYOUT CACHE
+
+Measuring text goes through the engine's font code on every call, and
+most HUD strings are the same from one frame to the next, so measured
+sizes and line breaks are cached by string content, scale and typeface.
+The cache is flushed when the font or accessibility cvars change, when
+pics are touched again, and when it grows too large.
+
+=============================================================================
+*/
+
+// flush the cache at the start of a frame once it holds this many strings
+constexpr size_t MAX_TEXT_LAYOUTS = 512;
+
+struct cg_text_key_view_t {
+	std::string_view text;
+	int32_t          scale = 0;
+	bool             alt = false;
+};
+
+struct cg_text_key_t {
+	std::string text;
+	int32_t     scale = 0;
+	bool        alt = false;
+
+	operator cg_text_key_view_t() const { return { text, scale, alt }; }
+};
+
+struct cg_text_key_hash_t {
+	using is_transparent = void;
+
+	size_t operator()(const cg_text_key_view_t& k) const noexcept {
+		size_t h = std::hash<std::string_view>{}(k.text);
+		h ^= static_cast<size_t>(k.scale) + 0x9e3779b9u + (h << 6) + (h >> 2);
+		return k.alt ? ~h : h;
+	}
+};
+
+struct cg_text_key_equal_t {
+	using is_transparent = void;
+
+	bool operator()(const cg_text_key_view_t& a, const cg_text_key_view_t& b) const noexcept {
+		return a.scale == b.scale && a.alt == b.alt && a.text == b.text;
+	}
+};
+
+struct cg_text_line_t {
+	size_t  offset = 0; // start of the line in the string
+	size_t  length = 0; // length of the line, not counting the newline
+	Vector2 size{};     // measured size from the start of the line
+};
+
+struct cg_text_layout_t {
+	Vector2 size{};                    // measured size of the whole string
+	bool    measured = false;
+	std::vector<cg_text_line_t> lines; // line breaks, filled on first use
+	bool    linesMeasured = false;     // whether the line sizes are filled
+};
+
+static std::unordered_map<cg_text_key_t, cg_text_layout_t, cg_text_key_hash_t, cg_text_key_equal_t> cg_text_layouts;
+
+// the typeface the engine is currently set to draw with
+static bool cg_alt_typeface = false;
+
+static uint32_t cg_text_usekfont_modified = 0;
+static uint32_t cg_text_alttypeface_modified = 0;
+
+/*
+===============
+CG_SetAltTypeface
+
+Switches the engine's typeface, remembering it so that measurements
+are cached per typeface.
+===============
+*/
+static void CG_SetAltTypeface(bool enabled) {
+	cg_alt_typeface = enabled;
+	cgi.SCR_SetAltTypeface(enabled);
+}
+
+/*
+===============
+CG_TextLayout
+
+Returns the cache entry for the given string at the current typeface,
+creating an empty one if needed.
+===============
+*/
+static cg_text_layout_t& CG_TextLayout(const char* str, int scale) {
+	const cg_text_key_view_t view{ str, scale, cg_alt_typeface };
+
+	if (auto it = cg_text_layouts.find(view); it != cg_text_layouts.end())
+		return it->second;
+
+	return cg_text_layouts.emplace(cg_text_key_t{ std::string(view.text), scale, cg_alt_typeface }, cg_text_layout_t{}).first->second;
+}
+
+/*
+===============
+CG_MeasureFontString
+
+Cached cgi.SCR_MeasureFontString.
+===============
+*/
+static Vector2 CG_MeasureFontString(const char* str, int scale) {
+	cg_text_layout_t& layout = CG_TextLayout(str, scale);
+
+	if (!layout.measured) {
+		layout.size = cgi.SCR_MeasureFontString(str, scale);
+		layout.measured = true;
+	}
+
+	return layout.size;
+}
+
+/*
+===============
+CG_TextLines
+
+Returns the cached line breaks of the given string; when measure is set,
+each line's size is filled in too, measured from the start of the line
+as the engine would measure it.
+===============
+*/
+static const std::vector<cg_text_line_t>& CG_TextLines(const char* str, int scale, bool measure) {
+	cg_text_layout_t& layout = CG_TextLayout(str, scale);
+
+	if (layout.lines.empty()) {
+		std::string_view input(str);
+		size_t offset = 0;
+
+		while (offset < input.size()) {
+			const size_t newline = std::min(input.find('\n', offset), input.size());
+			layout.lines.push_back({ offset, newline - offset });
+			offset = newline + 1;
+		}
+	}
+
+	if (measure && !layout.linesMeasured) {
+		for (auto& line : layout.lines)
+			line.size = CG_MeasureFontString(str + line.offset, scale);
+		layout.linesMeasured = true;
+	}
+
+	return layout.lines;
+}
+
+/*
+===============
+CG_CheckTextLayouts
+
+Called at the start of each HUD frame; flushes the cache if the font
+settings changed or it has grown too large.
+===============
+*/
+static void CG_CheckTextLayouts() {
+	const bool usekfontChanged = Cvar_WasModified(scr_usekfont, cg_text_usekfont_modified);
+	const bool alttypefaceChanged = Cvar_WasModified(ui_acc_alttypeface, cg_text_alttypeface_modified);
+
+	if (usekfontChanged || alttypefaceChanged || cg_text_layouts.size() >= MAX_TEXT_LAYOUTS)
+		cg_text_layouts.clear();
+}
+
 // max number of centerprints in the rotating buffer
 constexpr size_t MAX_CENTER_PRINTS = 4;
 
@@ -195,14 +362,14 @@ static void CG_DrawNotify(int32_t isplit, vrect_t hud_vrect, vrect_t hud_safe, i
 
 	y = (hud_vrect.y * scale) + hud_safe.y;
 
-	cgi.SCR_SetAltTypeface(ui_acc_alttypeface->integer && true);
+	CG_SetAltTypeface(ui_acc_alttypeface->integer && true);
 
 	if (ui_acc_contrast->integer) {
 		for (auto& msg : data.notify) {
 			if (!msg.is_active || !msg.message.length())
 				break;
 
-			Vector2 sz = cgi.SCR_MeasureFontString(msg.message.c_str(), scale);
+			Vector2 sz = CG_MeasureFontString(msg.message.c_str(), scale);
 			sz.x += 10; // extra padding for black bars
 			cgi.SCR_DrawColorPic((hud_vrect.x * scale) + hud_safe.x - 5, y, sz.x, 15 * scale, "_white", rgba_black);
 			y += 10 * scale;
@@ -218,7 +385,7 @@ static void CG_DrawNotify(int32_t isplit, vrect_t hud_vrect, vrect_t hud_safe, i
 		y += 10 * scale;
 	}
 
-	cgi.SCR_SetAltTypeface(false);
+	CG_SetAltTypeface(false);
 
 	// draw text input (only the main player can really chat anyways...)
 	if (isplit == 0) {
@@ -252,51 +419,38 @@ Returns:
 static int CG_DrawHUDString(const char* str, int x, int y, int centerwidth, int _xor, int scale, bool shadow = true) {
 	const int margin = x;
 	const bool useKFont = scr_usekfont->integer != 0;
-	std::string_view input(str);
-
-	while (!input.empty()) {
-		// Extract one line from input
-		const size_t newline = input.find('\n');
-		std::string_view line = input.substr(0, newline);
+	const auto& lines = CG_TextLines(str, scale, useKFont);
 
-		Vector2 size{};
+	for (size_t i = 0; i < lines.size(); i++) {
+		const cg_text_line_t& line = lines[i];
+		const char* text = str + line.offset;
 		int xpos = margin;
 
 		if (centerwidth > 0) {
-			if (useKFont) {
-				size = cgi.SCR_MeasureFontString(line.data(), scale);
-				xpos += static_cast<int>((centerwidth - size.x) / 2.0f);
-			}
-			else {
-				xpos += (centerwidth - static_cast<int>(line.size()) * CONCHAR_WIDTH * scale) / 2;
-			}
+			if (useKFont)
+				xpos += static_cast<int>((centerwidth - line.size.x) / 2.0f);
+			else
+				xpos += (centerwidth - static_cast<int>(line.length) * CONCHAR_WIDTH * scale) / 2;
 		}
 
 		if (useKFont) {
-			size = cgi.SCR_MeasureFontString(line.data(), scale);  // already needed for y step too
 			cgi.SCR_DrawFontString(
-				line.data(), xpos, y - (font_y_offset * scale), scale,
+				text, xpos, y - (font_y_offset * scale), scale,
 				_xor ? alt_color : rgba_white,
 				true, text_align_t::LEFT
 			);
-			xpos += size.x;
+			xpos += line.size.x;
 		}
 		else {
-			for (char ch : line) {
-				cgi.SCR_DrawChar(xpos, y, scale, ch ^ _xor, shadow);
+			for (size_t c = 0; c < line.length; c++) {
+				cgi.SCR_DrawChar(xpos, y, scale, text[c] ^ _xor, shadow);
 				xpos += CONCHAR_WIDTH * scale;
 			}
 		}
 
 		// Advance to next line
-		if (newline != std::string_view::npos) {
-			input.remove_prefix(newline + 1);
-			x = margin;
-			y += useKFont ? static_cast<int>(size.y) : CONCHAR_WIDTH * scale;
-		}
-		else {
-			break;
-		}
+		x = margin;
+		y += useKFont ? static_cast<int>(line.size.y) : CONCHAR_WIDTH * scale;
 	}
 
 	return x;
@@ -526,7 +680,7 @@ static void CG_DrawCenterString(const player_state_t* ps, const vrect_t& hud_vre
 	const int textOriginX = (hud_vrect.x + hud_vrect.width / 2 - 160) * scale;
 	const int textWidth = 320 * scale;
 
-	cgi.SCR_SetAltTypeface(ui_acc_alttypeface->integer);
+	CG_SetAltTypeface(ui_acc_alttypeface->integer);
 
 	// Instant mode: render all lines and binds immediately
 	if (center.instant) {
@@ -534,7 +688,7 @@ static void CG_DrawCenterString(const player_state_t* ps, const vrect_t& hud_vre
 			std::string_view view(line);
 
 			if (ui_acc_contrast->integer && !view.empty()) {
-				Vector2 size = cgi.SCR_MeasureFontString(view.data(), scale);
+				Vector2 size = CG_MeasureFontString(view.data(), scale);
 				size.x += 10;
 				const int barY = ui_acc_alttypeface->integer ? y - 8 : y;
 				cgi.SCR_DrawColorPic(centerX - static_cast<int>(size.x / 2), barY, size.x, lineHeight, "_white", rgba_black);
@@ -554,7 +708,7 @@ static void CG_DrawCenterString(const player_state_t* ps, const vrect_t& hud_vre
 			center.time_off = cgi.CL_ClientRealTime() + static_cast<int64_t>(scr_centertime->value * 1000);
 		}
 
-		cgi.SCR_SetAltTypeface(false);
+		CG_SetAltTypeface(false);
 		return;
 	}
 
@@ -592,7 +746,7 @@ static void CG_DrawCenterString(const player_state_t* ps, const vrect_t& hud_vre
 		int blinkyX;
 
 		if (ui_acc_contrast->integer && !line.empty()) {
-			Vector2 size = cgi.SCR_MeasureFontString(line.data(), scale);
+			Vector2 size = CG_MeasureFontString(line.data(), scale);
 			size.x += 10;
 			const int barY = ui_acc_alttypeface->integer ? y - 8 : y;
 			cgi.SCR_DrawColorPic(centerX - static_cast<int>(size.x / 2), barY, size.x, lineHeight, "_white", rgba_black);
@@ -616,7 +770,7 @@ static void CG_DrawCenterString(const player_state_t* ps, const vrect_t& hud_vre
 			break;
 	}
 
-	cgi.SCR_SetAltTypeface(false);
+	CG_SetAltTypeface(false);
 }
 
 static void CG_CheckDrawCenterString(const player_state_t* ps, const vrect_t& hud_vrect, const vrect_t& hud_safe, int isplit, int scale) {
@@ -753,7 +907,7 @@ static void CG_DrawTable(int x, int y, uint32_t width, uint32_t height, int32_t
 
 	// Draw each cell
 	int columnX = x0;
-	const int spaceWidth = static_cast<int>(cgi.SCR_MeasureFontString(" ", 1).x);
+	const int spaceWidth = static_cast<int>(CG_MeasureFontString(" ", 1).x);
 
 	for (int col = 0; col < hud_temp.num_columns; ++col) {
 		const int colWidth = hud_temp.column_widths[col];
@@ -761,7 +915,7 @@ static void CG_DrawTable(int x, int y, uint32_t width, uint32_t height, int32_t
 		int rowY = y0;
 		for (int row = 0; row < hud_temp.num_rows; ++row, rowY += (CONCHAR_WIDTH + font_y_offset) * scale) {
 			const char* text = hud_temp.table_rows[row].table_cells[col].text;
-			const Vector2 textSize = cgi.SCR_MeasureFontString(text, scale);
+			const Vector2 textSize = CG_MeasureFontString(text, scale);
 
 			int xOffset = 0;
 
@@ -931,7 +1085,7 @@ static void CG_ExecuteLayoutString(const char* s, vrect_t hud_vrect, vrect_t hud
 
 				const char* scr = G_Fmt("{}", score).data();
 
-				cgi.SCR_SetAltTypeface(ui_acc_alttypeface->integer && true);
+				CG_SetAltTypeface(ui_acc_alttypeface->integer && true);
 				if (!scr_usekfont->integer)
 					CG_DrawString(x + 32 * scale, y, scale, cgi.CL_GetClientName(value));
 				else
@@ -948,7 +1102,7 @@ static void CG_ExecuteLayoutString(const char* s, vrect_t hud_vrect, vrect_t hud
 				else
 					cgi.SCR_DrawFontString(G_Fmt("{}", ping).data(), x + 32 + 107 * scale, y + (10 - font_y_offset) * scale, scale, rgba_white, true, text_align_t::LEFT);
 
-				cgi.SCR_SetAltTypeface(false);
+				CG_SetAltTypeface(false);
 			}
 			continue;
 		}
@@ -985,13 +1139,13 @@ static void CG_ExecuteLayoutString(const char* s, vrect_t hud_vrect, vrect_t hud
 
 			if (!skip_depth) {
 
-				cgi.SCR_SetAltTypeface(ui_acc_alttypeface->integer && true);
+				CG_SetAltTypeface(ui_acc_alttypeface->integer && true);
 				cgi.SCR_DrawFontString(G_Fmt("{}", score).data(), x, y - (font_y_offset * scale), scale, value == playernum ? alt_color : rgba_white, true, text_align_t::LEFT);
 				x += 3 * 9 * scale;
 				cgi.SCR_DrawFontString(G_Fmt("{}", ping).data(), x, y - (font_y_offset * scale), scale, value == playernum ? alt_color : rgba_white, true, text_align_t::LEFT);
 				x += 3 * 9 * scale;
 				cgi.SCR_DrawFontString(cgi.CL_GetClientName(value), x, y - (font_y_offset * scale), scale, value == playernum ? alt_color : rgba_white, true, text_align_t::LEFT);
-				cgi.SCR_SetAltTypeface(false);
+				CG_SetAltTypeface(false);
 
 				if (*token) {
 					cgi.Draw_GetPicSize(&w, &h, token);
@@ -1139,9 +1293,9 @@ static void CG_ExecuteLayoutString(const char* s, vrect_t hud_vrect, vrect_t hud
 				if (!scr_usekfont->integer)
 					CG_DrawString(x, y, scale, cgi.get_configString(index));
 				else {
-					cgi.SCR_SetAltTypeface(ui_acc_alttypeface->integer && true);
+					CG_SetAltTypeface(ui_acc_alttypeface->integer && true);
 					cgi.SCR_DrawFontString(cgi.get_configString(index), x, y - (font_y_offset * scale), scale, rgba_white, true, text_align_t::LEFT);
-					cgi.SCR_SetAltTypeface(false);
+					CG_SetAltTypeface(false);
 				}
 			}
 			continue;
@@ -1165,9 +1319,9 @@ static void CG_ExecuteLayoutString(const char* s, vrect_t hud_vrect, vrect_t hud
 				if (!scr_usekfont->integer)
 					CG_DrawString(x, y, scale, cgi.get_configString(index));
 				else {
-					cgi.SCR_SetAltTypeface(ui_acc_alttypeface->integer && true);
+					CG_SetAltTypeface(ui_acc_alttypeface->integer && true);
 					cgi.SCR_DrawFontString(cgi.get_configString(index), x, y - (font_y_offset * scale), scale, alt_color, true, text_align_t::LEFT);
-					cgi.SCR_SetAltTypeface(false);
+					CG_SetAltTypeface(false);
 				}
 			}
 			continue;
@@ -1176,9 +1330,9 @@ static void CG_ExecuteLayoutString(const char* s, vrect_t hud_vrect, vrect_t hud
 		if (!strcmp(token, "cstring")) {
 			token = COM_Parse(&s);
 			if (!skip_depth) {
-				cgi.SCR_SetAltTypeface(ui_acc_alttypeface->integer && true);
+				CG_SetAltTypeface(ui_acc_alttypeface->integer && true);
 				CG_DrawHUDString(token, x, y, hx * 2 * scale, 0, scale);
-				cgi.SCR_SetAltTypeface(false);
+				CG_SetAltTypeface(false);
 			}
 			continue;
 		}
@@ -1189,9 +1343,9 @@ static void CG_ExecuteLayoutString(const char* s, vrect_t hud_vrect, vrect_t hud
 				if (!scr_usekfont->integer)
 					CG_DrawString(x, y, scale, token);
 				else {
-					cgi.SCR_SetAltTypeface(ui_acc_alttypeface->integer && true);
+					CG_SetAltTypeface(ui_acc_alttypeface->integer && true);
 					cgi.SCR_DrawFontString(token, x, y - (font_y_offset * scale), scale, rgba_white, true, text_align_t::LEFT);
-					cgi.SCR_SetAltTypeface(false);
+					CG_SetAltTypeface(false);
 				}
 			}
 			continue;
@@ -1200,9 +1354,9 @@ static void CG_ExecuteLayoutString(const char* s, vrect_t hud_vrect, vrect_t hud
 		if (!strcmp(token, "cstring2")) {
 			token = COM_Parse(&s);
 			if (!skip_depth) {
-				cgi.SCR_SetAltTypeface(ui_acc_alttypeface->integer && true);
+				CG_SetAltTypeface(ui_acc_alttypeface->integer && true);
 				CG_DrawHUDString(token, x, y, hx * 2 * scale, 0x80, scale);
-				cgi.SCR_SetAltTypeface(false);
+				CG_SetAltTypeface(false);
 			}
 			continue;
 		}
@@ -1213,9 +1367,9 @@ static void CG_ExecuteLayoutString(const char* s, vrect_t hud_vrect, vrect_t hud
 				if (!scr_usekfont->integer)
 					CG_DrawString(x, y, scale, token, true);
 				else {
-					cgi.SCR_SetAltTypeface(ui_acc_alttypeface->integer && true);
+					CG_SetAltTypeface(ui_acc_alttypeface->integer && true);
 					cgi.SCR_DrawFontString(token, x, y - (font_y_offset * scale), scale, alt_color, true, text_align_t::LEFT);
-					cgi.SCR_SetAltTypeface(false);
+					CG_SetAltTypeface(false);
 				}
 			}
 			continue;
@@ -1281,9 +1435,9 @@ static void CG_ExecuteLayoutString(const char* s, vrect_t hud_vrect, vrect_t hud
 				if (!scr_usekfont->integer)
 					CG_DrawString(x, y, scale, cgi.Localize(cgi.get_configString(index), nullptr, 0));
 				else {
-					cgi.SCR_SetAltTypeface(ui_acc_alttypeface->integer && true);
+					CG_SetAltTypeface(ui_acc_alttypeface->integer && true);
 					cgi.SCR_DrawFontString(cgi.Localize(cgi.get_configString(index), nullptr, 0), x, y - (font_y_offset * scale), scale, rgba_white, true, text_align_t::LEFT);
-					cgi.SCR_SetAltTypeface(false);
+					CG_SetAltTypeface(false);
 				}
 			}
 			continue;
@@ -1307,10 +1461,10 @@ static void CG_ExecuteLayoutString(const char* s, vrect_t hud_vrect, vrect_t hud
 				if (!scr_usekfont->integer)
 					CG_DrawString(x - (strlen(s) * CONCHAR_WIDTH * scale), y, scale, s);
 				else {
-					cgi.SCR_SetAltTypeface(ui_acc_alttypeface->integer && true);
-					Vector2 size = cgi.SCR_MeasureFontString(s, scale);
+					CG_SetAltTypeface(ui_acc_alttypeface->integer && true);
+					Vector2 size = CG_MeasureFontString(s, scale);
 					cgi.SCR_DrawFontString(s, x - size.x, y - (font_y_offset * scale), scale, rgba_white, true, text_align_t::LEFT);
-					cgi.SCR_SetAltTypeface(false);
+					CG_SetAltTypeface(false);
 				}
 			}
 			continue;
@@ -1330,9 +1484,9 @@ static void CG_ExecuteLayoutString(const char* s, vrect_t hud_vrect, vrect_t hud
 
 				if (index < 0 || index >= MAX_CONFIGSTRINGS)
 					cgi.Com_Error("Bad stat_string index");
-				cgi.SCR_SetAltTypeface(ui_acc_alttypeface->integer && true);
+				CG_SetAltTypeface(ui_acc_alttypeface->integer && true);
 				CG_DrawHUDString(cgi.Localize(cgi.get_configString(index), nullptr, 0), x, y, hx * 2 * scale, 0, scale);
-				cgi.SCR_SetAltTypeface(false);
+				CG_SetAltTypeface(false);
 			}
 			continue;
 		}
@@ -1351,9 +1505,9 @@ static void CG_ExecuteLayoutString(const char* s, vrect_t hud_vrect, vrect_t hud
 
 				if (index < 0 || index >= MAX_CONFIGSTRINGS)
 					cgi.Com_Error("Bad stat_string index");
-				cgi.SCR_SetAltTypeface(ui_acc_alttypeface->integer && true);
+				CG_SetAltTypeface(ui_acc_alttypeface->integer && true);
 				CG_DrawHUDString(cgi.Localize(cgi.get_configString(index), nullptr, 0), x, y, hx * 2 * scale, 0x80, scale);
-				cgi.SCR_SetAltTypeface(false);
+				CG_SetAltTypeface(false);
 			}
 			continue;
 		}
@@ -1381,7 +1535,7 @@ static void CG_ExecuteLayoutString(const char* s, vrect_t hud_vrect, vrect_t hud
 		}
 
 		if (!skip_depth) {
-		cgi.SCR_SetAltTypeface(ui_acc_alttypeface->integer && true);
+		CG_SetAltTypeface(ui_acc_alttypeface->integer && true);
 		CG_DrawHUDString(
 		cgi.Localize(arg_tokens[0].data(), arg_buffers.data(), num_args),
 		x,
@@ -1389,7 +1543,7 @@ static void CG_ExecuteLayoutString(const char* s, vrect_t hud_vrect, vrect_t hud
 		hx * 2 * scale,
 		0,
 		scale);
-		cgi.SCR_SetAltTypeface(false);
+		CG_SetAltTypeface(false);
 		}
 		continue;
 		}
@@ -1417,9 +1571,9 @@ static void CG_ExecuteLayoutString(const char* s, vrect_t hud_vrect, vrect_t hud
 		if (!scr_usekfont->integer)
 		CG_DrawString(x, y, scale, cgi.Localize(arg_tokens[0].data(), arg_buffers.data(), num_args));
 		else {
-		cgi.SCR_SetAltTypeface(ui_acc_alttypeface->integer && true);
+		CG_SetAltTypeface(ui_acc_alttypeface->integer && true);
 		cgi.SCR_DrawFontString(cgi.Localize(arg_tokens[0].data(), arg_buffers.data(), num_args), x, y - (font_y_offset * scale), scale, rgba_white, true, text_align_t::LEFT);
-		cgi.SCR_SetAltTypeface(false);
+		CG_SetAltTypeface(false);
 		}
 		}
 		continue;
@@ -1445,9 +1599,9 @@ static void CG_ExecuteLayoutString(const char* s, vrect_t hud_vrect, vrect_t hud
 		}
 
 		if (!skip_depth) {
-		cgi.SCR_SetAltTypeface(ui_acc_alttypeface->integer && true);
+		CG_SetAltTypeface(ui_acc_alttypeface->integer && true);
 		CG_DrawHUDString(cgi.Localize(arg_tokens[0].data(), arg_buffers.data(), num_args), x, y, hx * 2 * scale, 0x80, scale);
-		cgi.SCR_SetAltTypeface(false);
+		CG_SetAltTypeface(false);
 		}
 		continue;
 		}
@@ -1478,15 +1632,15 @@ static void CG_ExecuteLayoutString(const char* s, vrect_t hud_vrect, vrect_t hud
 		const char* locStr = cgi.Localize(arg_tokens[0].data(), arg_buffers.data(), num_args);
 		int xOffs = 0;
 		if (rightAlign) {
-		xOffs = scr_usekfont->integer ? cgi.SCR_MeasureFontString(locStr, scale).x : (strlen(locStr) * CONCHAR_WIDTH * scale);
+		xOffs = scr_usekfont->integer ? CG_MeasureFontString(locStr, scale).x : (strlen(locStr) * CONCHAR_WIDTH * scale);
 		}
 
 		if (!scr_usekfont->integer)
 		CG_DrawString(x - xOffs, y, scale, locStr, green);
 		else {
-		cgi.SCR_SetAltTypeface(ui_acc_alttypeface->integer && true);
+		CG_SetAltTypeface(ui_acc_alttypeface->integer && true);
 		cgi.SCR_DrawFontString(locStr, x - xOffs, y - (font_y_offset * scale), scale, green ? alt_color : rgba_white, true, text_align_t::LEFT);
-		cgi.SCR_SetAltTypeface(false);
+		CG_SetAltTypeface(false);
 		}
 		}
 		continue;
@@ -1517,14 +1671,14 @@ static void CG_ExecuteLayoutString(const char* s, vrect_t hud_vrect, vrect_t hud
 		const char* locStr = cgi.Localize("$g_score_time", arg_buffers.data(), 1);
 
 		const int xOffs = scr_usekfont->integer
-		? static_cast<int>(cgi.SCR_MeasureFontString(locStr, scale).x)
+		? static_cast<int>(CG_MeasureFontString(locStr, scale).x)
 		: static_cast<int>(strlen(locStr)) * CONCHAR_WIDTH * scale;
 
 		if (!scr_usekfont->integer) {
 		CG_DrawString(x - xOffs, y, scale, locStr, green);
 		}
 		else {
-		cgi.SCR_SetAltTypeface(ui_acc_alttypeface->integer && true);
+		CG_SetAltTypeface(ui_acc_alttypeface->integer && true);
 		cgi.SCR_DrawFontString(
 		locStr,
 		x - xOffs,
@@ -1534,7 +1688,7 @@ static void CG_ExecuteLayoutString(const char* s, vrect_t hud_vrect, vrect_t hud
 		true,
 		text_align_t::LEFT
 		);
-		cgi.SCR_SetAltTypeface(false);
+		CG_SetAltTypeface(false);
 		}
 		}
 		}
@@ -1573,7 +1727,7 @@ static void CG_ExecuteLayoutString(const char* s, vrect_t hud_vrect, vrect_t hud
 				if (!skip_depth) {
 					token = cgi.Localize(token, nullptr, 0);
 					Q_strlcpy(hud_temp.table_rows[0].table_cells[i].text, token, sizeof(hud_temp.table_rows[0].table_cells[i].text));
-					hud_temp.column_widths[i] = max(hud_temp.column_widths[i], (size_t)cgi.SCR_MeasureFontString(hud_temp.table_rows[0].table_cells[i].text, scale).x);
+					hud_temp.column_widths[i] = max(hud_temp.column_widths[i], (size_t)CG_MeasureFontString(hud_temp.table_rows[0].table_cells[i].text, scale).x);
 				}
 			}
 		}
@@ -1595,7 +1749,7 @@ static void CG_ExecuteLayoutString(const char* s, vrect_t hud_vrect, vrect_t hud
 				token = COM_Parse(&s);
 				if (!skip_depth) {
 					Q_strlcpy(row.table_cells[i].text, token, sizeof(row.table_cells[i].text));
-					hud_temp.column_widths[i] = max(hud_temp.column_widths[i], (size_t)cgi.SCR_MeasureFontString(row.table_cells[i].text, scale).x);
+					hud_temp.column_widths[i] = max(hud_temp.column_widths[i], (size_t)CG_MeasureFontString(row.table_cells[i].text, scale).x);
 				}
 			}
 
@@ -1614,7 +1768,7 @@ static void CG_ExecuteLayoutString(const char* s, vrect_t hud_vrect, vrect_t hud
 
 				for (int i = 0; i < hud_temp.num_columns; i++) {
 					if (i != 0)
-						total_inner_table_width += cgi.SCR_MeasureFontString(" ", scale).x;
+						total_inner_table_width += CG_MeasureFontString(" ", scale).x;
 
 					total_inner_table_width += hud_temp.column_widths[i];
 				}
@@ -1647,9 +1801,9 @@ static void CG_ExecuteLayoutString(const char* s, vrect_t hud_vrect, vrect_t hud
 				if (!scr_usekfont->integer)
 					CG_DrawString(x, y, scale, cgi.CL_GetClientName(index));
 				else {
-					cgi.SCR_SetAltTypeface(ui_acc_alttypeface->integer && true);
+					CG_SetAltTypeface(ui_acc_alttypeface->integer && true);
 					cgi.SCR_DrawFontString(cgi.CL_GetClientName(index), x, y - (font_y_offset * scale), scale, rgba_white, true, align);
-					cgi.SCR_SetAltTypeface(false);
+					CG_SetAltTypeface(false);
 				}
 			}
 			continue;
@@ -1661,9 +1815,9 @@ static void CG_ExecuteLayoutString(const char* s, vrect_t hud_vrect, vrect_t hud
 
 			const byte* stat = reinterpret_cast<const byte*>(&ps->stats[STAT_HEALTH_BARS]);
 			const char* name = cgi.Localize(cgi.get_configString(CONFIG_HEALTH_BAR_NAME), nullptr, 0);
-			cgi.SCR_SetAltTypeface(ui_acc_alttypeface->integer && true);
+			CG_SetAltTypeface(ui_acc_alttypeface->integer && true);
 			CG_DrawHUDString(name, (hud_vrect.x + hud_vrect.width / 2 + -160) * scale, y, (320 / 2) * 2 * scale, 0, scale);
-			cgi.SCR_SetAltTypeface(false);
+			CG_SetAltTypeface(false);
 			float bar_width = ((hud_vrect.width * scale) - (hud_safe.x * 2)) * 0.50f;
 			float bar_height = 4 * scale;
 
@@ -1696,13 +1850,13 @@ static void CG_ExecuteLayoutString(const char* s, vrect_t hud_vrect, vrect_t hud
 				continue;
 
 			const char* localized = cgi.Localize(story_str, nullptr, 0);
-			Vector2 size = cgi.SCR_MeasureFontString(localized, scale);
+			Vector2 size = CG_MeasureFontString(localized, scale);
 			float centerx = ((hud_vrect.x + (hud_vrect.width * 0.5f)) * scale);
 			float centery = ((hud_vrect.y + (hud_vrect.height * 0.5f)) * scale) - (size.y * 0.5f);
 
-			cgi.SCR_SetAltTypeface(ui_acc_alttypeface->integer && true);
+			CG_SetAltTypeface(ui_acc_alttypeface->integer && true);
 			cgi.SCR_DrawFontString(localized, centerx, centery, scale, rgba_white, true, text_align_t::CENTER);
-			cgi.SCR_SetAltTypeface(false);
+			CG_SetAltTypeface(false);
 		}
 	}
 
@@ -1825,6 +1979,8 @@ void CG_DrawHUD(int32_t isplit, const cg_server_data_t* data, vrect_t hud_vrect,
 		return;
 	}
 
+	CG_CheckTextLayouts();
+
 	// draw HUD
 	if (!cl_skipHud->integer && !(ps->stats[STAT_LAYOUTS] & LAYOUTS_HIDE_HUD))
 		CG_ExecuteLayoutString(cgi.get_configString(CS_STATUSBAR), hud_vrect, hud_safe, scale, playernum, ps);
@@ -1858,6 +2014,9 @@ void CG_TouchPics() {
 	cgi.Draw_RegisterPic("inventory");
 
 	font_y_offset = (cgi.SCR_FontLineHeight(1) - CONCHAR_WIDTH) / 2;
+
+	// fonts may have been reloaded
+	cg_text_layouts.clear();
 }
 
 void CG_InitScreen() {
@@ -1873,4 +2032,5 @@ void CG_InitScreen() {
 	ui_acc_alttypeface = cgi.cvar("ui_acc_alttypeface", "0", CVAR_NOFLAGS);
 
 	hud_data = {};
+	cg_text_layouts.clear();
 }
@@ -19,6 +19,7 @@ client_session_service_impl.cpp implementation.*/
 #include <algorithm>
 #include <array>
 #include <cctype>
+#include <charconv>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -548,6 +549,129 @@ static void ClientCheckPermissions(GameLocals& game, gentity_t* ent, const char*
 	ent->client->sess.admin = game.adminIDs.contains(id);
 }
 
+/* =============
+USERINFO
+
+Userinfo is tokenized once into views over the source string rather than
+rescanned per key; the fields below are looked up in that table.
+============= */
+
+constexpr size_t MAX_USERINFO_FIELDS = 64;
+
+// name changes allowed per window before further changes are held back
+constexpr int32_t MAX_NAME_CHANGES = 4;
+constexpr GameTime NAME_CHANGE_WINDOW = 10_sec;
+
+struct UserinfoView {
+	std::array<std::pair<std::string_view, std::string_view>, MAX_USERINFO_FIELDS> fields{};
+	size_t count = 0;
+
+	/*
+	=============
+	UserinfoView::Get
+
+	Matches Info_ValueForKey: the first occurrence wins, empty values count as
+	missing and values are clamped to MAX_INFO_VALUE.
+	=============
+	*/
+	bool Get(std::string_view key, std::string_view& out) const {
+		for (size_t i = 0; i < count; i++) {
+			if (fields[i].first != key)
+				continue;
+			out = fields[i].second.substr(0, MAX_INFO_VALUE - 1);
+			return !out.empty();
+		}
+		return false;
+	}
+};
+
+/*
+=============
+Userinfo_Tokenize
+
+Splits a "\key\value" string in a single pass. Fields past
+MAX_USERINFO_FIELDS are ignored.
+=============
+*/
+static UserinfoView Userinfo_Tokenize(const char* info) {
+	UserinfoView view{};
+	std::string_view s{ info ? info : "" };
+
+	if (!s.empty() && s.front() == '\\')
+		s.remove_prefix(1);
+
+	while (!s.empty() && view.count < view.fields.size()) {
+		const size_t keyEnd = s.find('\\');
+		if (keyEnd == std::string_view::npos)
+			break;
+
+		const std::string_view key = s.substr(0, keyEnd);
+		s.remove_prefix(keyEnd + 1);
+
+		const size_t valueEnd = s.find('\\');
+		const std::string_view value = s.substr(0, valueEnd);
+		s.remove_prefix(valueEnd == std::string_view::npos ? s.size() : valueEnd + 1);
+
+		view.fields[view.count++] = { key, value };
+	}
+
+	return view;
+}
+
+/*
+=============
+Userinfo_Int
+
+atoi-style parse of a userinfo view; stops at the first non-digit.
+=============
+*/
+static int Userinfo_Int(std::string_view value) {
+	while (!value.empty() && std::isspace(static_cast<unsigned char>(value.front())))
+		value.remove_prefix(1);
+	if (!value.empty() && value.front() == '+')
+		value.remove_prefix(1);
+
+	int result = 0;
+	std::from_chars(value.data(), value.data() + value.size(), result);
+	return result;
+}
+
+/*
+=============
+SetConfigStringIfChanged
+
+Skips the configstring write (and the broadcast it causes) when the value
+already matches.
+=============
+*/
+static void SetConfigStringIfChanged(local_game_import_t& gi, int index, const char* value) {
+	const char* current = gi.get_configString(index);
+	if (std::string_view{ current ? current : "" } != std::string_view{ value })
+		gi.configString(index, value);
+}
+
+/*
+=============
+ClientNameChangeAllowed
+
+Rate limits name changes in deathmatch so name-cycling scripts cannot force
+a configstring broadcast every frame. Bots and the initial name are exempt.
+=============
+*/
+static bool ClientNameChangeAllowed(const LevelLocals& level, gentity_t* ent) {
+	gclient_t* cl = ent->client;
+
+	if (!deathmatch->integer || !cl->sess.netName[0] || (ent->svFlags & SVF_BOT))
+		return true;
+
+	if (level.time - cl->flood.nameWindowStart >= NAME_CHANGE_WINDOW) {
+		cl->flood.nameWindowStart = level.time;
+		cl->flood.nameChanges = 0;
+	}
+
+	return ++cl->flood.nameChanges <= MAX_NAME_CHANGES;
+}
+
 } // namespace
 
 /*
@@ -687,6 +811,7 @@ gentity_t* ent, char* userInfo, const char* socialID, bool isBot) {
 	ClientUserinfoChanged(gi, game, level, ent, userInfo);
 
 	Q_strlcpy(ent->client->sess.socialID, safeSocialID, sizeof(ent->client->sess.socialID));
+	P_IndexClientSlot(ent->client);
 
 	std::array<char, MAX_INFO_VALUE> value = {};
 	// [Paril-KEX] fetch name because now netName is kinda unsuitable
@@ -756,6 +881,7 @@ gentity_t* ent, char* userInfo, const char* socialID, bool isBot) {
 	// count current clients and rank for scoreboard
 	CalculateRanks();
 	ent->client->pers.connected = true;
+	G_RosterConnect(ent->client);
 	ent->client->sess.inGame = false;
 
 	// [Paril-KEX] force a state update
@@ -788,6 +914,7 @@ void ClientSessionServiceImpl::ClientBegin(local_game_import_t& gi, GameLocals&
 
 	// [Paril-KEX] we're always connected by this point...
 	cl->pers.connected = true;
+	G_RosterConnect(cl);
 
 	if (deathmatch->integer) {
 		worr::server::client::ClientBeginDeathmatch(ent);
@@ -881,17 +1008,30 @@ gentity_t* ent, const char* userInfo) {
 	if (!userInfo)
 		userInfo = "";
 
+	const UserinfoView info = Userinfo_Tokenize(userInfo);
+	std::string_view field;
 	std::array<char, MAX_INFO_VALUE> value{};
-	std::array<char, MAX_INFO_VALUE> nameBuffer{};
 
-	// set name
-	if (!gi.Info_ValueForKey(userInfo, "name", nameBuffer.data(), nameBuffer.size()))
-		Q_strlcpy(nameBuffer.data(), "badinfo", nameBuffer.size());
-	Q_strlcpy(ent->client->sess.netName, nameBuffer.data(), sizeof(ent->client->sess.netName));
+	// set name; held back while the client is over the name change limit
+	if (!info.Get("name", field))
+		field = "badinfo";
+	const bool nameChanged = field.substr(0, sizeof(ent->client->sess.netName) - 1) != ent->client->sess.netName;
+	if (nameChanged && ClientNameChangeAllowed(level, ent)) {
+		const size_t len = std::min(field.size(), sizeof(ent->client->sess.netName) - 1);
+		std::memcpy(ent->client->sess.netName, field.data(), len);
+		ent->client->sess.netName[len] = '\0';
+	}
+	else if (nameChanged && ent->client->flood.nameChanges == MAX_NAME_CHANGES + 1) {
+		gi.LocClient_Print(ent, PRINT_HIGH, "Too many name changes, wait {} seconds.\n",
+			(NAME_CHANGE_WINDOW - (level.time - ent->client->flood.nameWindowStart)).seconds<int>() + 1);
+	}
 
 	// set skin
-	if (!gi.Info_ValueForKey(userInfo, "skin", value.data(), value.size()))
-		Q_strlcpy(value.data(), "male/grunt", value.size());
+	if (!info.Get("skin", field))
+		field = "male/grunt";
+	const size_t skinLen = std::min(field.size(), value.size() - 1);
+	std::memcpy(value.data(), field.data(), skinLen);
+	value[skinLen] = '\0';
 
 	const char* sanitizedSkin = ClientSkinOverride(value.data());
 	std::string_view sanitizedSkinView{ sanitizedSkin };
@@ -910,11 +1050,11 @@ gentity_t* ent, const char* userInfo) {
 	if (Teams())
 		AssignPlayerSkin(ent, sessionSkin);
 	else {
-		gi.configString(CS_PLAYERSKINS + playernum, G_Fmt("{}\\{}", ent->client->sess.netName, sessionSkin).data());
+		SetConfigStringIfChanged(gi, CS_PLAYERSKINS + playernum, G_Fmt("{}\\{}", ent->client->sess.netName, sessionSkin).data());
 	}
 
 	//  set player name field (used in id_state view)
-	gi.configString(CONFIG_CHASE_PLAYER_NAME + playernum, ent->client->sess.netName);
+	SetConfigStringIfChanged(gi, CONFIG_CHASE_PLAYER_NAME + playernum, ent->client->sess.netName);
 
 	// [Kex] netName is used for a couple of other things, so we update this after those.
 	if (!(ent->svFlags & SVF_BOT)) {
@@ -923,37 +1063,39 @@ gentity_t* ent, const char* userInfo) {
 	}
 
 	// fov
-	if (!gi.Info_ValueForKey(userInfo, "fov", value.data(), value.size())) {
-		std::snprintf(value.data(), value.size(), "%.0f", ent->client->ps.fov);
+	if (info.Get("fov", field)) {
+		ent->client->ps.fov = std::clamp(static_cast<float>(Userinfo_Int(field)), 1.f, 160.f);
+	}
+	else {
+		ent->client->ps.fov = std::clamp(std::round(ent->client->ps.fov), 1.f, 160.f);
 	}
-	ent->client->ps.fov = std::clamp(static_cast<float>(strtoul(value.data(), nullptr, 10)), 1.f, 160.f);
 
 	// handedness
-	if (gi.Info_ValueForKey(userInfo, "hand", value.data(), value.size())) {
-		ent->client->pers.hand = static_cast<Handedness>(std::clamp(atoi(value.data()), static_cast<int>(Handedness::Right), static_cast<int>(Handedness::Center)));
+	if (info.Get("hand", field)) {
+		ent->client->pers.hand = static_cast<Handedness>(std::clamp(Userinfo_Int(field), static_cast<int>(Handedness::Right), static_cast<int>(Handedness::Center)));
 	}
 	else {
 		ent->client->pers.hand = Handedness::Right;
 	}
 
 	// [Paril-KEX] auto-switch
-	if (gi.Info_ValueForKey(userInfo, "autoswitch", value.data(), value.size())) {
-		ent->client->pers.autoswitch = static_cast<WeaponAutoSwitch>(std::clamp(atoi(value.data()), static_cast<int>(WeaponAutoSwitch::Smart), static_cast<int>(WeaponAutoSwitch::Never)));
+	if (info.Get("autoswitch", field)) {
+		ent->client->pers.autoswitch = static_cast<WeaponAutoSwitch>(std::clamp(Userinfo_Int(field), static_cast<int>(WeaponAutoSwitch::Smart), static_cast<int>(WeaponAutoSwitch::Never)));
 	}
 	else {
 		ent->client->pers.autoswitch = WeaponAutoSwitch::Smart;
 	}
 
-	if (gi.Info_ValueForKey(userInfo, "autoshield", value.data(), value.size())) {
-		ent->client->pers.autoshield = atoi(value.data());
+	if (info.Get("autoshield", field)) {
+		ent->client->pers.autoshield = Userinfo_Int(field);
 	}
 	else {
 		ent->client->pers.autoshield = -1;
 	}
 
 	// [Paril-KEX] wants bob
-	if (gi.Info_ValueForKey(userInfo, "bobskip", value.data(), value.size())) {
-		ent->client->pers.bob_skip = value[0] == '1';
+	if (info.Get("bobskip", field)) {
+		ent->client->pers.bob_skip = field[0] == '1';
 	}
 	else {
 		ent->client->pers.bob_skip = false;
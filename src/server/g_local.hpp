@@ -11,6 +11,7 @@ class Menu;
 #include "../shared/version.hpp"
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <bitset> // for bitset
 #include <cctype>
 #include <filesystem>
@@ -19,8 +20,10 @@ class Menu;
 #include <mutex>
 #include <optional> // for AutoSelectNextMap()
 #include <random>
+#include <source_location>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -605,6 +608,47 @@ constexpr bool is_valid_loc_embed_v =
     std::is_integral_v<std::remove_reference_t<T>> || is_char_ptr_v<T> ||
     is_string_like_v<T>;
 
+// direct-mapped cache of engine PVS/PHS answers. Points are keyed exactly,
+// so an entry can only go stale when an areaportal changes or the map does;
+// it is also dropped at the start of every server frame.
+struct vis_cache_t {
+  static constexpr size_t SIZE = 1024;
+
+  struct entry_t {
+    Vector3 p1, p2;
+    uint32_t generation;
+    uint8_t kind;
+    bool result;
+  };
+
+  std::array<entry_t, SIZE> entries{};
+  uint32_t generation = 1;
+
+  inline void invalidate() { generation++; }
+
+  template <typename Query>
+  inline bool lookup(const Vector3 &p1, const Vector3 &p2, uint8_t kind,
+                     Query query) {
+    size_t hash = kind;
+
+    for (size_t i = 0; i < 3; i++) {
+      hash = hash * 31 + std::bit_cast<uint32_t>(p1[i]);
+      hash = hash * 31 + std::bit_cast<uint32_t>(p2[i]);
+    }
+
+    entry_t &entry = entries[(hash ^ (hash >> 16)) % SIZE];
+
+    if (entry.generation == generation && entry.kind == kind &&
+        entry.p1 == p1 && entry.p2 == p2)
+      return entry.result;
+
+    entry = {p1, p2, generation, kind, query()};
+    return entry.result;
+  }
+};
+
+inline vis_cache_t vis_cache;
+
 struct local_game_import_t : game_import_t {
   inline local_game_import_t() = default;
   inline local_game_import_t(const game_import_t &imports)
@@ -733,6 +777,31 @@ public:
                                contentmask);
   }
 
+  // visibility queries go through vis_cache; bits are PHS and portals
+  [[nodiscard]] inline bool inPVS(const Vector3 &p1, const Vector3 &p2,
+                                  bool portals) const {
+    return vis_cache.lookup(p1, p2, portals ? 1 : 0, [&]() {
+      return game_import_t::inPVS(p1, p2, portals);
+    });
+  }
+
+  [[nodiscard]] inline bool inPHS(const Vector3 &p1, const Vector3 &p2,
+                                  bool portals) const {
+    return vis_cache.lookup(p1, p2, portals ? 3 : 2, [&]() {
+      return game_import_t::inPHS(p1, p2, portals);
+    });
+  }
+
+  inline void SetAreaPortalState(int portalnum, bool open) const {
+    game_import_t::SetAreaPortalState(portalnum, open);
+    vis_cache.invalidate();
+  }
+
+  // skips relinks that would leave the area tree unchanged; defined below
+  // gentity_t
+  void linkEntity(gentity_t *ent, const std::source_location &where =
+                                      std::source_location::current());
+
   void unicast(gentity_t *ent, bool reliable, uint32_t dupe_key = 0) const {
     game_import_t::unicast(ent, reliable, dupe_key);
   }
@@ -1793,6 +1862,8 @@ enum ent_flags_t : uint64_t {
 
   FL_NO_BOTS = bit_v<35>,   // not to be used by bots
   FL_NO_HUMANS = bit_v<36>, // not to be used by humans
+
+  FL_LOW_INTEREST = bit_v<37>, // cosmetic; may be culled from snapshots
 };
 MAKE_ENUM_BITFLAGS(ent_flags_t);
 
@@ -2675,6 +2746,10 @@ struct GameLocals {
 
   gclient_t *clients; // [maxClients]
 
+  // client slots last seen disconnected; active_clients()/active_players()
+  // skip them until G_RosterConnect clears the bit again
+  std::array<uint64_t, MAX_CLIENTS / 64> rosterSkip{};
+
   // can't store spawnpoint in level, because
   // it would get overwritten by the savegame restore
   std::array<char, MAX_TOKEN_CHARS> spawnPoint; // needed for coop respawns
@@ -3294,6 +3369,8 @@ struct LevelLocals {
     bool forceExit = false;
   } mapSelector;
   std::array<Ghosts, MAX_CLIENTS> ghosts{};
+  // lowercased social ID -> ghosts slot; see P_RebuildGhostIndex
+  std::unordered_map<std::string, size_t> ghostIndex;
 
   int autoScreenshotTool_index = 0;
   bool autoScreenshotTool_initialised = false;
@@ -3821,6 +3898,7 @@ struct MonsterInfo {
       base_health; // health that we had on spawn, before any co-op adjustments
   int32_t health_scaling;        // number of players we've been scaled up to
   GameTime next_move_time;       // high tick rate
+  GameTime dormantTime; // parked out of every client's PHS since this time
   GameTime bad_move_time;        // don't try straight moves until this is over
   GameTime bump_time;            // don't slide against walls for a bit
   GameTime random_change_time;   // high tickrate
@@ -3855,6 +3933,12 @@ struct MonsterInfo {
   bool fly_thrusters; // slightly different flight mechanics, for melee attacks
   GameTime fly_recovery_time; // time to try a new dir to get away from hazards
   Vector3 fly_recovery_dir;
+  // hover planning cache, not saved; see G_FlyFitWantedPosition
+  Vector3 fly_fit_from, fly_fit_to; // last clear fit trace
+  bool fly_fit_clear;
+  GameTime fly_pinned_visible_time; // enemy known visible until
+  const gentity_t *fly_pinned_visible_enemy; // enemy that visibility was for
+  int32_t fly_pinned_visible_spawn_count;
 
   // teleport helpers
   Vector3 teleport_saved_origin;
@@ -4387,7 +4471,8 @@ void Domination_RunFrame();
 
 const char *PlaceString(int rank);
 bool ItemSpawnsEnabled();
-bool LocCanSee(gentity_t *targetEnt, gentity_t *sourceEnt);
+bool LocCanSee(gentity_t *targetEnt, gentity_t *sourceEnt,
+               const std::source_location &where = std::source_location::current());
 bool SetTeam(gentity_t *ent, Team desired_team, bool inactive, bool force,
              bool silent);
 const char *TimeString(const int msec, bool showMilliseconds, bool state);
@@ -4659,6 +4744,11 @@ bool M_droptofloor(gentity_t *ent);
 void monster_think(gentity_t *self);
 void monster_dead_think(gentity_t *self);
 void monster_dead(gentity_t *self);
+void M_RegisterCorpse(gentity_t *ent);
+void M_InvalidateCorpseRegistry();
+size_t M_CorpsesInRadius(const Vector3 &org, float rad, gentity_t **list,
+                         size_t maxCount);
+bool M_CorpseVisible(gentity_t *medic, gentity_t *corpse);
 void walkmonster_start(gentity_t *self);
 void swimmonster_start(gentity_t *self);
 void flymonster_start(gentity_t *self);
@@ -4670,6 +4760,8 @@ bool M_CheckAttack(gentity_t *self);
 void M_CheckGround(gentity_t *ent, contents_t mask);
 void monster_use(gentity_t *self, gentity_t *other, gentity_t *activator);
 void M_ProcessPain(gentity_t *e);
+void M_WakeDormant(gentity_t *self);
+void M_WakeDormantAround(const Vector3 &origin);
 bool M_ShouldReactToPain(gentity_t *self, const MeansOfDeath &mod);
 void M_SetAnimation(gentity_t *self, const save_mmove_t &move,
                     bool instant = true);
@@ -4860,6 +4952,11 @@ void fire_homing_pod(gentity_t *self, const Vector3 &start, const Vector3 &dir,
                      int damage, int speed, MonsterMuzzleFlashID flashType);
 int G_ExplodeNearbyMinesSafe(const Vector3 &origin, float radius,
                              gentity_t *safe);
+void G_MuzzleFlash(gentity_t *ent, const Vector3 &origin, uint8_t flash,
+                   multicast_t to);
+void G_MonsterMuzzleFlash(gentity_t *ent, const Vector3 &origin,
+                          MonsterMuzzleFlashID id);
+void G_FlushMuzzleFlashes();
 
 Vector3 P_CurrentKickAngles(gentity_t *ent);
 Vector3 P_CurrentKickOrigin(gentity_t *ent);
@@ -4900,9 +4997,11 @@ void pierce_trace(const Vector3 &start, const Vector3 &end, gentity_t *ignore,
 //
 // g_ptrail.cpp
 //
+struct PlayerTrailPoint;
 void PlayerTrail_Add(gentity_t *player);
 void PlayerTrail_Destroy(gentity_t *player);
-gentity_t *PlayerTrail_Pick(gentity_t *self, bool next);
+void PlayerTrail_Hunted(gentity_t *player);
+const PlayerTrailPoint *PlayerTrail_Pick(gentity_t *self, bool next);
 
 //
 // g_client.cpp
@@ -5095,6 +5194,7 @@ bool M_CheckBottom_Slow_Generic(const Vector3 &origin, const Vector3 &absmins,
                                 contents_t mask, const Vector3 &gravityDir,
                                 bool allow_any_step_height);
 bool M_CheckBottom(gentity_t *ent);
+void M_ClearSupportCache();
 bool G_CloseEnough(gentity_t *ent, gentity_t *goal, float dist);
 bool M_walkmove(gentity_t *ent, float yaw, float dist);
 void M_MoveToGoal(gentity_t *ent, float dist);
@@ -5229,6 +5329,7 @@ gentity_t *SpawnBadArea(const Vector3 &mins, const Vector3 &maxs,
 gentity_t *CheckForBadArea(gentity_t *ent);
 bool MarkTeslaArea(gentity_t *self, gentity_t *tesla);
 void InitHintPaths();
+void G_LoadHintPaths();
 void PredictAim(gentity_t *self, gentity_t *target, const Vector3 &start,
                 float bolt_speed, bool eye_height, float offset,
                 Vector3 *aimDir, Vector3 *aimPoint);
@@ -5271,6 +5372,7 @@ bool FindSpawnPoint(const Vector3 &startpoint, const Vector3 &mins,
                     bool drop = true, bool ceiling = false);
 bool CheckSpawnPoint(const Vector3 &origin, const Vector3 &mins,
                      const Vector3 &maxs);
+void ClearSpawnPointCache();
 bool CheckGroundSpawnPoint(const Vector3 &origin, const Vector3 &entMins,
                            const Vector3 &entMaxs, float height,
                            bool ceiling = false);
@@ -5293,6 +5395,9 @@ bool P_UseCoopInstancedItems();
 void PushAward(gentity_t *ent, PlayerMedal medal);
 void P_SaveGhostSlot(gentity_t *ent);
 void P_RestoreFromGhostSlot(gentity_t *ent);
+void P_RebuildGhostIndex();
+void P_IndexClientSlot(const gclient_t *cl);
+void P_InvalidateClientSlotIndex();
 bool InitPlayerTeam(gentity_t *ent);
 void ClientSetReadyStatus(gentity_t &ent, bool state, bool toggle);
 void ClientSetReadyStatus(gentity_t *ent, bool state, bool toggle);
@@ -5598,6 +5703,16 @@ constexpr GameTime COOP_DAMAGE_RESPAWN_TIME = 2000_ms;
 // time after firing that we can't respawn on a player for
 constexpr GameTime COOP_DAMAGE_FIRING_TIME = 2500_ms;
 
+// number of breadcrumbs kept in each client's player trail
+constexpr size_t PLAYER_TRAIL_LENGTH = 8;
+
+// a single breadcrumb in a client's player trail
+struct PlayerTrailPoint {
+  Vector3 origin = vec3_origin;
+  float yaw = 0;       // direction of travel from the previous point
+  GameTime time = 0_ms; // when the point was dropped
+};
+
 // this structure is cleared on each ClientSpawn(),
 // except for 'client->pers'
 struct gclient_t {
@@ -5741,6 +5856,8 @@ struct gclient_t {
     GameTime lockUntil = 0_ms;                  // locked from talking
     std::array<GameTime, 10> messageTimes = {}; // when messages were sent
     int32_t time = 0;                           // head pointer for when said
+    GameTime nameWindowStart = 0_ms;            // start of name change window
+    int32_t nameChanges = 0;                    // name changes in the window
   } flood;
 
   // follow cam not required to persist
@@ -5793,8 +5910,14 @@ struct gclient_t {
 
   GameTime vampiricExpireTime = 0_ms;
 
-  // used for player trails.
-  gentity_t *trail_head = nullptr, *trail_tail = nullptr;
+  // used for player trails; a fixed ring of points rather than
+  // entities, only sampled while a monster is hunting us.
+  struct {
+    std::array<PlayerTrailPoint, PLAYER_TRAIL_LENGTH> points{};
+    uint8_t head = 0;  // the next point to write to
+    uint8_t count = 0; // 0 to PLAYER_TRAIL_LENGTH, how many are valid
+    GameTime huntedTime = 0_ms; // sample only until this time
+  } trail;
   // whether to use weapon chains
   bool noWeaponChains = false;
 
@@ -6015,6 +6138,13 @@ struct gentity_t {
   const char *className = nullptr;
   SpawnFlags spawnFlags;
   bool turretFireRequested{};
+  struct {
+    Vector3 aimPoint{}; // breach: point the current moveAngles aim at
+    bool aimValid = false;
+    Vector3 sightPoint{}; // brain: last point traced for line of sight
+    GameTime sightTime = 0_ms;
+    bool sightClear = false;
+  } turret;
 
   GameTime timeStamp{};
 
@@ -6126,8 +6256,6 @@ struct gentity_t {
   Vector3 gravityVector{};
   gentity_t *bad_area = nullptr;
   gentity_t *hint_chain = nullptr;
-  gentity_t *monster_hint_chain = nullptr;
-  gentity_t *target_hint_chain = nullptr;
   int32_t hint_chain_id{};
 
   char clock_message[CLOCK_MESSAGE_SIZE]{};
@@ -6173,11 +6301,31 @@ struct gentity_t {
 
   // instanced coop items
   std::bitset<MAX_CLIENTS> itemPickedUpBy{};
+  // FL_LOW_INTEREST entities culled from these clients' snapshots
+  std::bitset<MAX_CLIENTS> interestHiddenFrom{};
   GameTime slime_debounce_time{};
 
   // [Paril-KEX]
   bmodel_anim_t bmodel_anim{};
 
+  // resting toss/step entity; physics is skipped until something changes
+  struct {
+    bool asleep;
+    Vector3 origin;
+    gentity_t *ground;
+    int32_t linkCount;
+  } physicsSleep{};
+
+  // straight-line missile: how far the static world is clear along its path
+  struct {
+    bool valid;
+    Vector3 origin; // where the next push has to start for the cache to apply
+    Vector3 velocity; // as of the last push, swept or not
+    Vector3 mins, maxs;
+    contents_t mask;
+    Vector3 clearEnd;
+  } missilePath{};
+
   MeansOfDeath lastMOD{};
   const char *style_on = nullptr;
   const char *style_off = nullptr;
@@ -6232,8 +6380,113 @@ struct gentity_t {
   Vector3 mangle = vec3_origin;    // oblivion
 
   saved_spawn_t *saved = {};
+
+  // what the last gi.linkEntity handed the engine
+  struct {
+    Vector3 origin;
+    Vector3 angles;
+    Vector3 oldOrigin;
+    Vector3 mins, maxs;
+    solid_t solid;
+    svflags_t svFlags;
+    int32_t modelIndex;
+    int32_t linkCount;
+    bool valid;
+  } lastLink{};
+
+  // last muzzle flash sent for this entity; see G_QueueMuzzleFlash
+  struct {
+    GameTime time;
+    uint16_t id;
+    bool monster;
+    bool valid;
+  } lastMuzzleFlash{};
+};
+
+// call sites for the per-site counters below
+struct CallSiteKey {
+  const char *file;
+  uint32_t line;
+
+  bool operator==(const CallSiteKey &) const = default;
+};
+
+struct CallSiteKeyHash {
+  size_t operator()(const CallSiteKey &key) const {
+    return std::hash<const char *>{}(key.file) ^ (size_t(key.line) << 1);
+  }
+};
+
+struct LinkSiteStats {
+  uint32_t relinked = 0;
+  uint32_t skipped = 0;
+};
+
+// per call site counts of gi.linkEntity calls that relinked vs. were skipped;
+// only collected while "sv linkstats on" is in effect
+inline std::unordered_map<CallSiteKey, LinkSiteStats, CallSiteKeyHash>
+    linkSiteStats;
+inline bool linkSiteStatsEnabled = false;
+
+struct VisSiteStats {
+  uint32_t calls = 0;
+  uint32_t visible = 0;
+  uint32_t traces = 0;
+  uint32_t pvsSkipped = 0;
 };
 
+// per call site counts of LocCanSee calls and the traces they cost; only
+// collected while "sv visstats on" is in effect
+inline std::unordered_map<CallSiteKey, VisSiteStats, CallSiteKeyHash>
+    visSiteStats;
+inline bool visSiteStatsEnabled = false;
+
+/*
+=============
+local_game_import_t::linkEntity
+
+Relinking makes the engine redo area nodes and PVS clusters, so only pass
+the call through when origin, bounds, solidity, model or flags changed
+since the last link, or something else (unlink, engine) touched it.
+Angles only matter for rotating BSP models and oldOrigin for beams.
+=============
+*/
+inline void local_game_import_t::linkEntity(gentity_t *ent,
+                                            const std::source_location &where) {
+  auto &last = ent->lastLink;
+  const bool unchanged =
+      last.valid && ent->linked && last.linkCount == ent->linkCount &&
+      last.origin == ent->s.origin && last.mins == ent->mins &&
+      last.maxs == ent->maxs && last.solid == ent->solid &&
+      last.svFlags == ent->svFlags && last.modelIndex == ent->s.modelIndex &&
+      (ent->solid != SOLID_BSP || last.angles == ent->s.angles) &&
+      (!(ent->s.renderFX & RF_BEAM) || last.oldOrigin == ent->s.oldOrigin);
+
+  if (linkSiteStatsEnabled) {
+    LinkSiteStats &stats = linkSiteStats[{where.file_name(), where.line()}];
+    if (unchanged)
+      stats.skipped++;
+    else
+      stats.relinked++;
+  }
+
+  if (unchanged)
+    return;
+
+  game_import_t::linkEntity(ent);
+
+  last.origin = ent->s.origin;
+  last.angles = ent->s.angles;
+  last.oldOrigin = ent->s.oldOrigin;
+  last.mins = ent->mins;
+  last.maxs = ent->maxs;
+  last.solid = ent->solid;
+  last.svFlags = ent->svFlags;
+  last.modelIndex = ent->s.modelIndex;
+  last.linkCount = ent->linkCount;
+  last.valid = true;
+}
+
 constexpr SpawnFlags SF_SPHERE_DEFENDER = 0x0001_spawnflag;
 constexpr SpawnFlags SF_SPHERE_HUNTER = 0x0002_spawnflag;
 constexpr SpawnFlags SF_SPHERE_VENGEANCE = 0x0004_spawnflag;
@@ -6418,6 +6671,86 @@ public:
   inline entity_iterator_t<TFilter> end() const { return end_index; }
 };
 
+// every path that sets pers.connected must call this, or the slot may stay
+// hidden from the client rosters
+inline void G_RosterConnect(const gclient_t *cl) {
+  if (!game.clients || cl < game.clients || cl >= game.clients + game.maxClients)
+    return;
+
+  const size_t slot = cl - game.clients;
+  game.rosterSkip[slot / 64] &= ~(1ull << (slot % 64));
+}
+
+// iterate client slots in order, only visiting ones not flagged in
+// game.rosterSkip. slots found disconnected on the way are flagged, so
+// loops cost what is connected rather than maxClients. the filter is still
+// applied to every visited slot, so results match a full scan.
+template <typename TFilter> struct client_roster_iterator_t {
+private:
+  uint32_t slot;
+  TFilter filter;
+
+  inline uint32_t slot_limit() const {
+    return globals.numEntities
+               ? std::min<uint32_t>(game.maxClients, globals.numEntities - 1)
+               : 0;
+  }
+
+  inline void advance() {
+    const uint32_t limit = slot_limit();
+
+    while (slot < limit) {
+      const uint64_t skip = game.rosterSkip[slot / 64] >> (slot % 64);
+
+      // jump over a run of skipped slots
+      if (skip & 1) {
+        const uint32_t run = std::countr_one(skip);
+        slot += run;
+        continue;
+      }
+
+      gentity_t *ent = &g_entities[slot + 1];
+
+      if (filter(ent))
+        return;
+
+      if (ent->client && !ent->client->pers.connected)
+        game.rosterSkip[slot / 64] |= 1ull << (slot % 64);
+
+      slot++;
+    }
+
+    slot = limit;
+  }
+
+public:
+  inline client_roster_iterator_t(uint32_t start) : slot(start) { advance(); }
+
+  inline gentity_t *operator*() const { return &g_entities[slot + 1]; }
+
+  inline client_roster_iterator_t &operator++() {
+    slot++;
+    advance();
+    return *this;
+  }
+
+  inline bool operator==(const client_roster_iterator_t &it) const {
+    return slot == it.slot;
+  }
+  inline bool operator!=(const client_roster_iterator_t &it) const {
+    return slot != it.slot;
+  }
+};
+
+template <typename TFilter> struct client_roster_iterable_t {
+  inline client_roster_iterator_t<TFilter> begin() const {
+    return client_roster_iterator_t<TFilter>(0);
+  }
+  inline client_roster_iterator_t<TFilter> end() const {
+    return client_roster_iterator_t<TFilter>(MAX_CLIENTS);
+  }
+};
+
 // inUse clients that are connected; may not be spawned yet, however
 struct active_clients_filter_t {
   inline bool operator()(gentity_t *ent) const {
@@ -6425,8 +6758,8 @@ struct active_clients_filter_t {
   }
 };
 
-inline entity_iterable_t<active_clients_filter_t> active_clients() {
-  return entity_iterable_t<active_clients_filter_t>{1u, game.maxClients};
+inline client_roster_iterable_t<active_clients_filter_t> active_clients() {
+  return {};
 }
 
 // inUse players that are connected; may not be spawned yet, however
@@ -6437,8 +6770,8 @@ struct active_players_filter_t {
   }
 };
 
-inline entity_iterable_t<active_players_filter_t> active_players() {
-  return entity_iterable_t<active_players_filter_t>{1u, game.maxClients};
+inline client_roster_iterable_t<active_players_filter_t> active_players() {
+  return {};
 }
 
 struct gib_def_t {
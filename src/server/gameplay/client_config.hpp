@@ -1,9 +1,13 @@
 #pragma once
 
 #include <cstdint>
+#include <filesystem>
 #include <functional>
+#include <list>
+#include <memory>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 struct gclient_t;
@@ -29,8 +33,34 @@ ClientConfigStore(local_game_import_t& gi, std::string playerConfigDirectory);
 		std::string PlayerNameForSocialID(const std::string& socialID) const;
 
 	private:
+		// parsed profile documents, keyed by config path; a document is only
+		// reused while the file on disk still has the size and write time it
+		// was read or written with, so hand edits and imports are picked up
+		struct ProfileIndexEntry {
+			std::filesystem::file_time_type writeTime{};
+			std::uintmax_t size = 0;
+			std::string playerName;
+			std::shared_ptr<Json::Value> data;
+			std::list<std::string>::iterator lruPosition{}; // valid while data is set
+		};
+
+		enum class ProfileReadResult {
+			Loaded,
+			Missing,
+			Invalid
+		};
+
+		static constexpr size_t kMaxCachedProfiles = 256;
+
 local_game_import_t& gi_;
 		std::string playerConfigDirectory_;
+		mutable std::unordered_map<std::string, ProfileIndexEntry> profileIndex_;
+		mutable std::list<std::string> profileLru_; // cached documents, most recently used first
+
+		ProfileReadResult ReadProfile(const std::string& path, Json::Value& out, std::string* errs = nullptr) const;
+		bool WriteProfile(const std::string& path, const Json::Value& data) const;
+		void IndexProfile(const std::string& path, const Json::Value& data) const;
+		void TouchProfile(ProfileIndexEntry& entry) const;
 
 		bool EnsurePlayerConfigDirectory() const;
 		std::optional<std::string> PlayerConfigPathFromID(const std::string& playerID, const char* functionName) const;
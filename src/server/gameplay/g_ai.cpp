@@ -435,6 +435,8 @@ void HuntTarget(gentity_t* self, bool animate_state) {
 }
 
 void FoundTarget(gentity_t* self) {
+	M_WakeDormant(self);
+
 	// let other monsters see this monster for a while
 	if (self->enemy->client) {
 		if (self->enemy->flags & FL_DISGUISED)
@@ -442,6 +444,7 @@ void FoundTarget(gentity_t* self) {
 
 		self->enemy->client->sight_entity = self;
 		self->enemy->client->sight_entity_time = level.time;
+		M_WakeDormantAround(self->s.origin);
 
 		self->enemy->show_hostile = level.time + 1_sec; // wake up other monsters
 	}
@@ -1240,7 +1243,7 @@ void ai_run(gentity_t* self, float dist) {
 	gentity_t* tempgoal;
 	gentity_t* save;
 	bool     newEnemy;
-	gentity_t* marker;
+	const PlayerTrailPoint* marker;
 	float    d1, d2;
 	trace_t  tr;
 	Vector3   vForward, v_right;
@@ -1251,6 +1254,10 @@ void ai_run(gentity_t* self, float dist) {
 	bool     gotcha = false;
 	gentity_t* realEnemy;
 
+	// keep our enemy dropping trail points while we're after them
+	if (self->enemy && self->enemy->client)
+		PlayerTrail_Hunted(self->enemy);
+
 	// if we're going to a combat point, just proceed
 	if (self->monsterInfo.aiFlags & AI_COMBAT_POINT) {
 		ai_checkattack(self, dist);
@@ -1501,9 +1508,9 @@ void ai_run(gentity_t* self, float dist) {
 		}
 
 		if (marker) {
-			self->monsterInfo.lastSighting = marker->s.origin;
-			self->monsterInfo.trailTime = marker->timeStamp;
-			self->s.angles[YAW] = self->ideal_yaw = marker->s.angles[YAW];
+			self->monsterInfo.lastSighting = marker->origin;
+			self->monsterInfo.trailTime = marker->time;
+			self->s.angles[YAW] = self->ideal_yaw = marker->yaw;
 
 			newEnemy = true;
 		}
@@ -13,6 +13,7 @@ helper functions for AI, like checking if a target is behind a monster (`inback`
 bosses (`BossExplode`).*/
 
 #include "../g_local.hpp"
+#include <unordered_map>
 
 //===============================
 // BLOCKED Logic
@@ -247,10 +248,171 @@ BlockedJumpResult blocked_checkjump(gentity_t* self, float dist) {
 constexpr SpawnFlags SPAWNFLAG_HINT_ENDPOINT = 0x0001_spawnflag;
 constexpr size_t   MAX_HINT_CHAINS = 100;
 
+// a hint_path must be within this range of both the monster
+// and its enemy to be considered
+constexpr float HINT_PATH_RANGE = 512.f;
+
+// bucket size of the hint graph's spatial index; matching the
+// search range means a search only visits the 3x3 buckets
+// around the searcher
+constexpr float HINT_BUCKET_SIZE = HINT_PATH_RANGE;
+
 int		 hint_paths_present;
 gentity_t* hint_path_start[MAX_HINT_CHAINS];
 int		 num_hint_paths;
 
+/*
+The hint graph is built once per level from the chains linked up
+by InitHintPaths. hint_paths never move or relink at runtime, so
+rather than rebuilding the chains every time a monster loses its
+enemy, searches look up nearby nodes through a bucket index and
+use each node's chain and position to know which other nodes it
+can reach along its chain.
+*/
+struct HintNode {
+	gentity_t* ent = nullptr;
+	int32_t		chain = -1; // index into hint_path_start
+	int32_t		index = 0;  // position along the chain, 0 being the start point
+};
+
+struct HintBucketKey {
+	int32_t x = 0, y = 0;
+	bool operator==(const HintBucketKey& o) const noexcept { return x == o.x && y == o.y; }
+};
+
+struct HintBucketKeyHash {
+	size_t operator()(const HintBucketKey& k) const noexcept {
+		uint32_t a = static_cast<uint32_t>(k.x);
+		uint32_t b = static_cast<uint32_t>(k.y);
+		a ^= b + 0x9e3779b9u + (a << 6) + (a >> 2);
+		return size_t(a);
+	}
+};
+
+static struct {
+	std::vector<HintNode> nodes;		   // all chained hint_paths, each chain stored contiguously in order
+	std::vector<uint32_t> chainFirst;  // index of each chain's start node in nodes
+	std::vector<int32_t>  entityNode;  // entity number -> node, or -1
+	std::unordered_map<HintBucketKey, std::vector<uint32_t>, HintBucketKeyHash> buckets;
+} hint_graph;
+
+/*
+===============
+HintGraph_BucketFromPos
+===============
+*/
+static inline HintBucketKey HintGraph_BucketFromPos(const Vector3& p) {
+	return HintBucketKey{
+		static_cast<int32_t>(floorf(p[0] / HINT_BUCKET_SIZE)),
+		static_cast<int32_t>(floorf(p[1] / HINT_BUCKET_SIZE))
+	};
+}
+
+/*
+===============
+HintGraph_Build
+
+Flattens the linked hint chains into the hint graph. Must be
+called after the chains have been linked or restored.
+===============
+*/
+static void HintGraph_Build() {
+	hint_graph.nodes.clear();
+	hint_graph.chainFirst.clear();
+	hint_graph.buckets.clear();
+	hint_graph.entityNode.assign(globals.numEntities, -1);
+
+	for (int32_t i = 0; i < num_hint_paths; i++) {
+		hint_graph.chainFirst.push_back(static_cast<uint32_t>(hint_graph.nodes.size()));
+
+		int32_t index = 0;
+
+		for (gentity_t* e = hint_path_start[i]; e; e = e->hint_chain) {
+			const uint32_t n = static_cast<uint32_t>(hint_graph.nodes.size());
+
+			hint_graph.nodes.push_back({ e, i, index++ });
+			hint_graph.entityNode[e->s.number] = static_cast<int32_t>(n);
+			hint_graph.buckets[HintGraph_BucketFromPos(e->s.origin)].push_back(n);
+		}
+	}
+}
+
+/*
+===============
+HintGraph_NodeForEntity
+===============
+*/
+static const HintNode* HintGraph_NodeForEntity(const gentity_t* ent) {
+	if (ent->s.number >= hint_graph.entityNode.size())
+		return nullptr;
+
+	const int32_t n = hint_graph.entityNode[ent->s.number];
+
+	return n < 0 ? nullptr : &hint_graph.nodes[n];
+}
+
+/*
+===============
+HintGraph_NodeOnChain
+
+Returns the node at the given position along a chain, or null
+if the position is off either end.
+===============
+*/
+static const HintNode* HintGraph_NodeOnChain(int32_t chain, int32_t index) {
+	if (index < 0)
+		return nullptr;
+
+	const uint32_t n = hint_graph.chainFirst[chain] + index;
+
+	if (n >= hint_graph.nodes.size() || hint_graph.nodes[n].chain != chain)
+		return nullptr;
+
+	return &hint_graph.nodes[n];
+}
+
+/*
+===============
+HintGraph_NodesInRange
+
+Gathers the nodes within HINT_PATH_RANGE of the given entity,
+using only the buckets around it.
+===============
+*/
+static void HintGraph_NodesInRange(gentity_t* ent, std::vector<const HintNode*>& out) {
+	const HintBucketKey center = HintGraph_BucketFromPos(ent->s.origin);
+
+	for (int32_t x = center.x - 1; x <= center.x + 1; x++)
+		for (int32_t y = center.y - 1; y <= center.y + 1; y++) {
+			auto it = hint_graph.buckets.find({ x, y });
+
+			if (it == hint_graph.buckets.end())
+				continue;
+
+			for (uint32_t n : it->second)
+				if (realrange(ent, hint_graph.nodes[n].ent) <= HINT_PATH_RANGE)
+					out.push_back(&hint_graph.nodes[n]);
+		}
+}
+
+/*
+===============
+HintGraph_Visible
+
+visible() with a PVS rejection first, since most nodes in range
+of a monster are on the other side of a wall.
+===============
+*/
+static bool HintGraph_Visible(gentity_t* viewer, gentity_t* node) {
+	Vector3 eye = viewer->s.origin;
+	eye[2] += viewer->viewHeight;
+
+	if (!gi.inPVS(eye, node->s.origin, false))
+		return false;
+
+	return visible(viewer, node);
+}
+
 //
 // AI code
 //
@@ -386,17 +548,8 @@ void hintpath_stop(gentity_t* self) {
 //		it will not go for it.
 // =============
 bool monsterlost_checkhint(gentity_t* self) {
-	gentity_t* e, * monster_pathchain, * target_pathchain, * checkpoint = nullptr;
-	gentity_t* closest;
-	float	 closest_range = 1000000;
-	gentity_t* start, * destination;
-	int		 count5 = 0;
-	float	 r;
-	int		 i;
-	bool	 hint_path_represented[MAX_HINT_CHAINS]{};
-
 	// if there are no hint paths on this map, exit immediately.
-	if (!hint_paths_present)
+	if (!hint_paths_present || hint_graph.nodes.empty())
 		return false;
 
 	if (!self->enemy)
@@ -409,251 +562,90 @@ bool monsterlost_checkhint(gentity_t* self) {
 	if (!Q_strcasecmp(self->className, "monster_turret"))
 		return false;
 
-	monster_pathchain = nullptr;
-
-	// find all the hint_paths.
-	// FIXME - can we not do this every time?
-	for (i = 0; i < num_hint_paths; i++) {
-		e = hint_path_start[i];
-		while (e) {
-			if (e->monster_hint_chain)
-				e->monster_hint_chain = nullptr;
-
-			if (monster_pathchain) {
-				checkpoint->monster_hint_chain = e;
-				checkpoint = e;
-			}
-			else {
-				monster_pathchain = e;
-				checkpoint = e;
-			}
-			e = e->hint_chain;
-		}
-	}
-
-	// filter them by distance and visibility to the monster
-	e = monster_pathchain;
-	checkpoint = nullptr;
-	while (e) {
-		r = realrange(self, e);
-
-		if (r > 512) {
-			if (checkpoint) {
-				checkpoint->monster_hint_chain = e->monster_hint_chain;
-				e->monster_hint_chain = nullptr;
-				e = checkpoint->monster_hint_chain;
-				continue;
-			}
-			else {
-				// use checkpoint as temp pointer
-				checkpoint = e;
-				e = e->monster_hint_chain;
-				checkpoint->monster_hint_chain = nullptr;
-				// and clear it again
-				checkpoint = nullptr;
-				// since we have yet to find a valid one (or else checkpoint would be set) move the
-				// start of monster_pathchain
-				monster_pathchain = e;
-				continue;
-			}
-		}
-		if (!visible(self, e)) {
-			if (checkpoint) {
-				checkpoint->monster_hint_chain = e->monster_hint_chain;
-				e->monster_hint_chain = nullptr;
-				e = checkpoint->monster_hint_chain;
-				continue;
-			}
-			else {
-				// use checkpoint as temp pointer
-				checkpoint = e;
-				e = e->monster_hint_chain;
-				checkpoint->monster_hint_chain = nullptr;
-				// and clear it again
-				checkpoint = nullptr;
-				// since we have yet to find a valid one (or else checkpoint would be set) move the
-				// start of monster_pathchain
-				monster_pathchain = e;
-				continue;
-			}
-		}
+	// gather the nodes in range of both sides first; only chains
+	// that have nodes near both of us are worth tracing against.
+	static std::vector<const HintNode*> monster_nodes, target_nodes;
+	std::bitset<MAX_HINT_CHAINS> monster_chains, target_chains;
 
-		count5++;
-		checkpoint = e;
-		e = e->monster_hint_chain;
-	}
+	monster_nodes.clear();
+	HintGraph_NodesInRange(self, monster_nodes);
 
-	// at this point, we have a list of all of the eligible hint nodes for the monster
-	// we now take them, figure out what hint chains they're on, and traverse down those chains,
-	// seeing whether any can see the player
-	//
-	// first, we figure out which hint chains we have represented in monster_pathchain
-	if (count5 == 0)
+	if (monster_nodes.empty())
 		return false;
 
-	for (i = 0; i < num_hint_paths; i++)
-		hint_path_represented[i] = false;
+	for (const HintNode* node : monster_nodes)
+		monster_chains.set(node->chain);
 
-	e = monster_pathchain;
-	checkpoint = nullptr;
-	while (e) {
-		if ((e->hint_chain_id < 0) || (e->hint_chain_id > num_hint_paths))
-			return false;
+	target_nodes.clear();
+	HintGraph_NodesInRange(self->enemy, target_nodes);
 
-		hint_path_represented[e->hint_chain_id] = true;
-		e = e->monster_hint_chain;
-	}
+	for (const HintNode* node : target_nodes)
+		target_chains.set(node->chain);
 
-	count5 = 0;
+	const std::bitset<MAX_HINT_CHAINS> shared_chains = monster_chains & target_chains;
 
-	// now, build the target_pathchain which contains all of the hint_path nodes we need to check for
-	// validity (within range, visibility)
-	target_pathchain = nullptr;
-	checkpoint = nullptr;
-	for (i = 0; i < num_hint_paths; i++) {
-		// if this hint chain is represented in the monster_hint_chain, add all of it's nodes to the target_pathchain
-		// for validity checking
-		if (hint_path_represented[i]) {
-			e = hint_path_start[i];
-			while (e) {
-				if (target_pathchain) {
-					checkpoint->target_hint_chain = e;
-					checkpoint = e;
-				}
-				else {
-					target_pathchain = e;
-					checkpoint = e;
-				}
-				e = e->hint_chain;
-			}
-		}
-	}
+	if (shared_chains.none())
+		return false;
 
-	// target_pathchain is a list of all of the hint_path nodes we need to check for validity relative to the target
-	e = target_pathchain;
-	checkpoint = nullptr;
-	while (e) {
-		r = realrange(self->enemy, e);
+	// filter the enemy's nodes by visibility; these are
+	// the chains we could reach the enemy along.
+	target_chains.reset();
 
-		if (r > 512) {
-			if (checkpoint) {
-				checkpoint->target_hint_chain = e->target_hint_chain;
-				e->target_hint_chain = nullptr;
-				e = checkpoint->target_hint_chain;
-				continue;
-			}
-			else {
-				// use checkpoint as temp pointer
-				checkpoint = e;
-				e = e->target_hint_chain;
-				checkpoint->target_hint_chain = nullptr;
-				// and clear it again
-				checkpoint = nullptr;
-				target_pathchain = e;
-				continue;
-			}
-		}
-		if (!visible(self->enemy, e)) {
-			if (checkpoint) {
-				checkpoint->target_hint_chain = e->target_hint_chain;
-				e->target_hint_chain = nullptr;
-				e = checkpoint->target_hint_chain;
-				continue;
-			}
-			else {
-				// use checkpoint as temp pointer
-				checkpoint = e;
-				e = e->target_hint_chain;
-				checkpoint->target_hint_chain = nullptr;
-				// and clear it again
-				checkpoint = nullptr;
-				target_pathchain = e;
-				continue;
-			}
-		}
+	std::erase_if(target_nodes, [&](const HintNode* node) {
+		if (!shared_chains.test(node->chain) || !HintGraph_Visible(self->enemy, node->ent))
+			return true;
 
-		count5++;
-		checkpoint = e;
-		e = e->target_hint_chain;
-	}
+		target_chains.set(node->chain);
+		return false;
+	});
 
-	// at this point we should have:
-	// monster_pathchain - a list of "monster valid" hint_path nodes linked together by monster_hint_chain
-	// target_pathcain - a list of "target valid" hint_path nodes linked together by target_hint_chain.  these
-	//                   are filtered such that only nodes which are on the same chain as "monster valid" nodes
-	//
-	// Now, we figure out which "monster valid" node we want to use
-	//
-	// To do this, we first off make sure we have some target nodes.  If we don't, there are no valid hint_path nodes
-	// for us to take
-	//
-	// If we have some, we filter all of our "monster valid" nodes by which ones have "target valid" nodes on them
-	//
-	// Once this filter is finished, we select the closest "monster valid" node, and go to it.
-
-	if (count5 == 0)
+	if (target_chains.none())
 		return false;
 
-	// reuse the hint_chain_represented array, this time to see which chains are represented by the target
-	for (i = 0; i < num_hint_paths; i++)
-		hint_path_represented[i] = false;
+	// now we figure out which node we want to go to; the closest
+	// one to us that we can see on a chain the enemy can be reached by.
+	const HintNode* start = nullptr;
+	float closest_range = std::numeric_limits<float>::infinity();
 
-	e = target_pathchain;
-	checkpoint = nullptr;
-	while (e) {
-		if ((e->hint_chain_id < 0) || (e->hint_chain_id > num_hint_paths))
-			return false;
+	for (const HintNode* node : monster_nodes) {
+		if (!target_chains.test(node->chain))
+			continue;
 
-		hint_path_represented[e->hint_chain_id] = true;
-		e = e->target_hint_chain;
-	}
+		const float r = realrange(self, node->ent);
 
-	// traverse the monster_pathchain - if the hint_node isn't represented in the "target valid" chain list,
-	// remove it
-	// if it is on the list, check it for range from the monster.  If the range is the closest, keep it
-	//
-	closest = nullptr;
-	e = monster_pathchain;
-	while (e) {
-		if (!(hint_path_represented[e->hint_chain_id])) {
-			checkpoint = e->monster_hint_chain;
-			e->monster_hint_chain = nullptr;
-			e = checkpoint;
+		if (r >= closest_range || !HintGraph_Visible(self, node->ent))
 			continue;
-		}
-		r = realrange(self, e);
-		if (r < closest_range)
-			closest = e;
-		e = e->monster_hint_chain;
+
+		start = node;
+		closest_range = r;
 	}
 
-	if (!closest)
+	if (!start)
 		return false;
 
-	start = closest;
 	// now we know which one is the closest to the monster .. this is the one the monster will go to
 	// we need to finally determine what the DESTINATION node is for the monster .. walk down the hint_chain,
 	// and find the closest one to the player
+	const HintNode* destination = nullptr;
+	closest_range = std::numeric_limits<float>::infinity();
 
-	closest = nullptr;
-	closest_range = 10000000;
-	e = target_pathchain;
-	while (e) {
-		if (start->hint_chain_id == e->hint_chain_id) {
-			r = realrange(self, e);
-			if (r < closest_range)
-				closest = e;
+	for (const HintNode* node : target_nodes) {
+		if (node->chain != start->chain)
+			continue;
+
+		const float r = realrange(self->enemy, node->ent);
+
+		if (r < closest_range) {
+			destination = node;
+			closest_range = r;
 		}
-		e = e->target_hint_chain;
 	}
 
-	if (!closest)
+	if (!destination)
 		return false;
 
-	destination = closest;
-
-	self->monsterInfo.goal_hint = destination;
-	hintpath_go(self, start);
+	self->monsterInfo.goal_hint = destination->ent;
+	hintpath_go(self, start->ent);
 
 	return true;
 }
@@ -666,8 +658,7 @@ bool monsterlost_checkhint(gentity_t* self) {
 // hint_path_touch - someone's touched the hint_path
 // =============
 static TOUCH(hint_path_touch) (gentity_t* self, gentity_t* other, const trace_t& tr, bool otherTouchingSelf) -> void {
-	gentity_t* e, * goal, * next = nullptr;
-	bool goalFound = false;
+	gentity_t* goal, * next = nullptr;
 
 	// make sure we're the target of it's obsession
 	if (other->moveTarget == self) {
@@ -678,25 +669,16 @@ static TOUCH(hint_path_touch) (gentity_t* self, gentity_t* other, const trace_t&
 			hintpath_stop(other);
 			return;
 		}
-		else {
-			// if we aren't, figure out which way we want to go
-			e = hint_path_start[self->hint_chain_id];
-			while (e) {
-				// if we get up to ourselves on the hint chain, we're going down it
-				if (e == self) {
-					next = e->hint_chain;
-					break;
-				}
-				if (e == goal)
-					goalFound = true;
-				// if we get to where the next link on the chain is this hint_path and have found the goal on the way
-				// we're going upstream, so remember who the previous link is
-				if ((e->hint_chain == self) && goalFound) {
-					next = e;
-					break;
-				}
-				e = e->hint_chain;
-			}
+		else if (const HintNode* node = HintGraph_NodeForEntity(self)) {
+			// if we aren't, figure out which way we want to go;
+			// if the goal is behind us on our chain we're going
+			// upstream, otherwise we're going down it
+			const HintNode* goal_node = goal ? HintGraph_NodeForEntity(goal) : nullptr;
+			const bool upstream = goal_node && goal_node->chain == node->chain && goal_node->index < node->index;
+			const HintNode* next_node = HintGraph_NodeOnChain(node->chain, node->index + (upstream ? -1 : 1));
+
+			if (next_node)
+				next = next_node->ent;
 		}
 
 		// if we couldn't find it, have the monster go back to normal hunting.
@@ -750,6 +732,8 @@ void InitHintPaths() {
 	int		 i;
 
 	hint_paths_present = 0;
+	num_hint_paths = 0;
+	HintGraph_Build();
 
 	// check all the hint_paths.
 	e = G_FindByString<&gentity_t::className>(nullptr, "hint_path");
@@ -811,6 +795,37 @@ void InitHintPaths() {
 			}
 		}
 	}
+
+	HintGraph_Build();
+}
+
+/*
+===============
+G_LoadHintPaths
+
+Restores the hint chain starts and hint graph after loading a
+level from a save; the chain links themselves are saved on the
+hint_path entities.
+===============
+*/
+void G_LoadHintPaths() {
+	hint_paths_present = 0;
+	num_hint_paths = 0;
+	memset(hint_path_start, 0, MAX_HINT_CHAINS * sizeof(gentity_t*));
+
+	for (gentity_t* e = nullptr; (e = G_FindByString<&gentity_t::className>(e, "hint_path")) != nullptr; ) {
+		hint_paths_present = 1;
+
+		if (!e->spawnFlags.has(SPAWNFLAG_HINT_ENDPOINT) || !e->target || e->targetName)
+			continue;
+		if (e->hint_chain_id < 0 || e->hint_chain_id >= static_cast<int32_t>(MAX_HINT_CHAINS) || hint_path_start[e->hint_chain_id])
+			continue;
+
+		hint_path_start[e->hint_chain_id] = e;
+		num_hint_paths = std::max(num_hint_paths, e->hint_chain_id + 1);
+	}
+
+	HintGraph_Build();
 }
 
 // *****************************
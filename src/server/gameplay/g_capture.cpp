@@ -55,12 +55,19 @@ namespace {
 		void RecordCapture(GameTime time, Team team);
 		[[nodiscard]] GameTime LastCaptureTime() const;
 		[[nodiscard]] Team LastCaptureTeam() const;
+		void SetBaseFlag(Team team, gentity_t* flag);
+		[[nodiscard]] gentity_t* BaseFlag(Team team) const;
+		void SetCarrier(Team team, gentity_t* carrier);
+		[[nodiscard]] gentity_t* Carrier(Team team) const;
 		void UpdateConfigString() const;
 
 	private:
+		// baseFlag and carrier are hints; callers revalidate them before use
 		struct FlagData {
 			FlagStatus status = FlagStatus::AtBase;
 			GameTime lastTaken = 0_sec;
+			gentity_t* baseFlag = nullptr;
+			gentity_t* carrier = nullptr;
 		};
 
 		[[nodiscard]] static std::optional<size_t> IndexForTeam(Team team);
@@ -108,6 +115,8 @@ namespace {
 		for (auto& entry : data_) {
 			entry.status = FlagStatus::AtBase;
 			entry.lastTaken = 0_sec;
+			entry.baseFlag = nullptr;
+			entry.carrier = nullptr;
 		}
 		lastCaptureTime_ = 0_sec;
 		lastCaptureTeam_ = Team::None;
@@ -220,6 +229,60 @@ namespace {
 		return lastCaptureTeam_;
 	}
 
+	/*
+	=============
+	FlagStateManager::SetBaseFlag
+
+	Remembers the in-world base flag entity for the provided team.
+	=============
+	*/
+	void FlagStateManager::SetBaseFlag(Team team, gentity_t* flag) {
+		const auto index = IndexForTeam(team);
+		if (!index) {
+			return;
+		}
+
+		data_.at(*index).baseFlag = flag;
+	}
+
+	/*
+	=============
+	FlagStateManager::BaseFlag
+
+	Returns the remembered base flag entity for the provided team.
+	=============
+	*/
+	gentity_t* FlagStateManager::BaseFlag(Team team) const {
+		return DataFor(team).baseFlag;
+	}
+
+	/*
+	=============
+	FlagStateManager::SetCarrier
+
+	Remembers the player carrying the provided team's flag.
+	=============
+	*/
+	void FlagStateManager::SetCarrier(Team team, gentity_t* carrier) {
+		const auto index = IndexForTeam(team);
+		if (!index) {
+			return;
+		}
+
+		data_.at(*index).carrier = carrier;
+	}
+
+	/*
+	=============
+	FlagStateManager::Carrier
+
+	Returns the remembered carrier of the provided team's flag.
+	=============
+	*/
+	gentity_t* FlagStateManager::Carrier(Team team) const {
+		return DataFor(team).carrier;
+	}
+
 	/*
 	=============
 	FlagStateManager::IndexForTeam
@@ -546,13 +609,20 @@ namespace {
 			return std::nullopt;
 		}
 
-		gentity_t* flag = nullptr;
+		gentity_t* flag = Flags().BaseFlag(team);
+		if (flag && flag->inUse && flag->className && !strcmp(flag->className, className) && !IsDroppedFlag(flag)) {
+			return flag;
+		}
+
+		flag = nullptr;
 		while ((flag = G_FindByString<&gentity_t::className>(flag, className)) != nullptr) {
 			if (!IsDroppedFlag(flag)) {
+				Flags().SetBaseFlag(team, flag);
 				return flag;
 			}
 		}
 
+		Flags().SetBaseFlag(team, nullptr);
 		return std::nullopt;
 	}
 
@@ -564,12 +634,31 @@ namespace {
 	=============
 	*/
 	[[nodiscard]] gentity_t* FindFlagCarrier(item_id_t flagItem) {
-		gentity_t* carrier = nullptr;
+		const auto flagTeam = TeamFromFlagItem(flagItem);
+		if (!flagTeam) {
+			return nullptr;
+		}
+
+		gentity_t* carrier = Flags().Carrier(*flagTeam);
+		if (carrier && carrier->inUse && carrier->client && carrier->client->pers.connected &&
+			carrier->client->pers.inventory[flagItem]) {
+			return carrier;
+		}
+
+		// nobody can be holding a flag that is home or lying on the ground
+		const FlagStatus status = Flags().GetStatus(*flagTeam);
+		if (status == FlagStatus::AtBase || status == FlagStatus::Dropped) {
+			Flags().SetCarrier(*flagTeam, nullptr);
+			return nullptr;
+		}
+
+		carrier = nullptr;
 		Teamplay_ForEachClient([&carrier, flagItem](gentity_t* entity) {
 			if (!carrier && entity->client->pers.inventory[flagItem]) {
 				carrier = entity;
 			}
 			});
+		Flags().SetCarrier(*flagTeam, carrier);
 		return carrier;
 	}
 
@@ -852,6 +941,7 @@ namespace {
 		player->client->pers.inventory[flagItem] = 1;
 		player->client->resp.ctf_flagsince = level.time;
 		player->client->pers.match.ctfFlagPickups++;
+		Flags().SetCarrier(flagTeam, player);
 
 		if (flagItem == IT_FLAG_NEUTRAL) {
 			FlagStatus status = FlagStatus::Taken;
@@ -1190,6 +1280,8 @@ bool CTF_ResetTeamFlag(Team team) {
 		}
 	}
 
+	Flags().SetCarrier(team, nullptr);
+
 	if (found) {
 		SetFlagStatus(team, FlagStatus::AtBase);
 		if (restored && Game::Is(GameType::CaptureStrike)) {
@@ -1257,6 +1349,7 @@ bool CTF_PickupFlag(gentity_t* ent, gentity_t* other) {
 				}
 				other->client->pers.inventory[enemyFlagItem] = 0;
 				other->client->resp.ctf_flagsince = 0_ms;
+				Flags().SetCarrier(Teams_OtherTeam(flagTeam), nullptr);
 
 				AwardFlagCapture(ent, other, flagTeam, pickupTime);
 				CTF_ResetFlags();
@@ -1292,6 +1385,7 @@ bool CTF_PickupFlag(gentity_t* ent, gentity_t* other) {
 		other->client->pers.inventory[IT_FLAG_NEUTRAL] = 0;
 		other->client->resp.ctf_flagsince = 0_ms;
 		other->client->pers.teamState.flag_pickup_time = 0_ms;
+		Flags().SetCarrier(Team::Free, nullptr);
 
 		AwardFlagCapture(ent, other, scoringTeam, pickupTime);
 		CTF_ResetTeamFlag(Team::Free);
@@ -1408,6 +1502,8 @@ void CTF_DeadDropFlag(gentity_t* self) {
 	}
 
 	if (droppedTeam != Team::None) {
+		Flags().SetCarrier(droppedTeam, nullptr);
+
 		GameTime carryStart = self->client->resp.ctf_flagsince;
 		if (!carryStart) {
 			carryStart = self->client->pers.teamState.flag_pickup_time;
@@ -1521,6 +1617,12 @@ THINK(CTF_FlagSetup)(gentity_t* ent)->void {
 	ent->s.origin = tr.endPos;
 	gi.linkEntity(ent);
 
+	if (ent->item && !IsDroppedFlag(ent)) {
+		if (const auto team = TeamFromFlagItem(ent->item->id)) {
+			Flags().SetBaseFlag(*team, ent);
+		}
+	}
+
 	ent->nextThink = level.time + 10_hz;
 	ent->think = CTF_FlagThink;
 }
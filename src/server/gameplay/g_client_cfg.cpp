@@ -27,6 +27,24 @@ namespace {
 	constexpr int kDefaultSkillRating = 1500;
 	const std::string kDefaultPlayerConfigDirectory = GAMEVERSION + "/pcfg";
 
+	/*
+	=============
+	ProfileFileStamp
+
+	Fetches the size and write time used to tell whether a cached profile
+	still matches the file on disk.
+	=============
+	*/
+	bool ProfileFileStamp(const std::string& path, std::filesystem::file_time_type& writeTime, std::uintmax_t& size) {
+		std::error_code ec;
+		writeTime = std::filesystem::last_write_time(path, ec);
+		if (ec)
+			return false;
+
+		size = std::filesystem::file_size(path, ec);
+		return !ec;
+	}
+
 	} // namespace
 
 	/*
@@ -66,6 +84,123 @@ ClientConfigStore::ClientConfigStore(local_game_import_t& gi, std::string player
 	return true;
 }
 
+/*
+=============
+ClientConfigStore::TouchProfile
+
+Marks a cached profile document as the most recently used one.
+=============
+*/
+void ClientConfigStore::TouchProfile(ProfileIndexEntry& entry) const {
+	profileLru_.splice(profileLru_.begin(), profileLru_, entry.lruPosition);
+}
+
+/*
+=============
+ClientConfigStore::IndexProfile
+
+Records a profile document and its on-disk stamp in the index, evicting the
+least recently used cached document when too many are held. Names stay
+indexed so admin lookups never need to reparse a profile.
+=============
+*/
+void ClientConfigStore::IndexProfile(const std::string& path, const Json::Value& data) const {
+	std::filesystem::file_time_type writeTime;
+	std::uintmax_t size = 0;
+	if (!ProfileFileStamp(path, writeTime, size)) {
+		auto it = profileIndex_.find(path);
+		if (it != profileIndex_.end()) {
+			if (it->second.data)
+				profileLru_.erase(it->second.lruPosition);
+			profileIndex_.erase(it);
+		}
+		return;
+	}
+
+	auto& entry = profileIndex_[path];
+
+	if (!entry.data) {
+		if (profileLru_.size() >= kMaxCachedProfiles) {
+			auto victim = profileIndex_.find(profileLru_.back());
+			if (victim != profileIndex_.end())
+				victim->second.data.reset();
+			profileLru_.pop_back();
+		}
+
+		entry.data = std::make_shared<Json::Value>(data);
+		entry.lruPosition = profileLru_.insert(profileLru_.begin(), path);
+	}
+	else {
+		*entry.data = data;
+		TouchProfile(entry);
+	}
+
+	entry.writeTime = writeTime;
+	entry.size = size;
+	entry.playerName = data.isMember("playerName") && data["playerName"].isString() ? data["playerName"].asString() : std::string();
+}
+
+/*
+=============
+ClientConfigStore::ReadProfile
+
+Fetches a profile document, reusing the indexed copy while the file is
+unchanged and parsing it from disk otherwise.
+=============
+*/
+ClientConfigStore::ProfileReadResult ClientConfigStore::ReadProfile(const std::string& path, Json::Value& out, std::string* errs) const {
+	std::filesystem::file_time_type writeTime;
+	std::uintmax_t size = 0;
+	if (!ProfileFileStamp(path, writeTime, size))
+		return ProfileReadResult::Missing;
+
+	auto it = profileIndex_.find(path);
+	if (it != profileIndex_.end() && it->second.data && it->second.writeTime == writeTime && it->second.size == size) {
+		out = *it->second.data;
+		TouchProfile(it->second);
+		return ProfileReadResult::Loaded;
+	}
+
+	std::ifstream in(path);
+	if (!in.is_open())
+		return ProfileReadResult::Missing;
+
+	Json::CharReaderBuilder builder;
+	std::string parseErrors;
+	if (!Json::parseFromStream(builder, in, &out, &parseErrors)) {
+		if (errs)
+			*errs = std::move(parseErrors);
+		return ProfileReadResult::Invalid;
+	}
+	in.close();
+
+	IndexProfile(path, out);
+	return ProfileReadResult::Loaded;
+}
+
+/*
+=============
+ClientConfigStore::WriteProfile
+
+Writes a profile document to disk and refreshes its index entry.
+Returns false when the file could not be opened for writing.
+=============
+*/
+bool ClientConfigStore::WriteProfile(const std::string& path, const Json::Value& data) const {
+	std::ofstream out(path);
+	if (!out.is_open())
+		return false;
+
+	Json::StreamWriterBuilder writerBuilder;
+	writerBuilder["indentation"] = "\t";
+	std::unique_ptr<Json::StreamWriter> writer(writerBuilder.newStreamWriter());
+	writer->write(data, &out);
+	out.close();
+
+	IndexProfile(path, data);
+	return true;
+}
+
 	/*
 	=============
 	ClientConfigStore::SaveInternal
@@ -87,17 +222,17 @@ void ClientConfigStore::SaveInternal(const std::string& playerID, int skillRatin
 	bool modified = false;
 
 	{
-		std::ifstream in(path);
-		if (in.is_open()) {
-			Json::CharReaderBuilder builder;
-			std::string errs;
-			if (!Json::parseFromStream(builder, in, &cfg, &errs)) {
-				gi_.Com_PrintFmt("{}: parse error in {}: {}\n", __FUNCTION__, path.c_str(), errs.c_str());
-				cfg = Json::Value(Json::objectValue);
-			}
-		}
-		else {
+		std::string errs;
+		switch (ReadProfile(path, cfg, &errs)) {
+		case ProfileReadResult::Loaded:
+			break;
+		case ProfileReadResult::Invalid:
+			gi_.Com_PrintFmt("{}: parse error in {}: {}\n", __FUNCTION__, path.c_str(), errs.c_str());
+			cfg = Json::Value(Json::objectValue);
+			break;
+		case ProfileReadResult::Missing:
 			gi_.Com_PrintFmt("{}: creating new player config for missing file {}\n", __FUNCTION__, path.c_str());
+			break;
 		}
 	}
 
@@ -274,18 +409,11 @@ void ClientConfigStore::SaveInternal(const std::string& playerID, int skillRatin
 			return;
 		}
 
-		std::ofstream out(path);
-		if (!out.is_open()) {
+		if (!WriteProfile(path, cfg)) {
 			gi_.Com_PrintFmt("{}: failed to write {}\n", __FUNCTION__, path.c_str());
 			return;
 		}
 
-		Json::StreamWriterBuilder writerBuilder;
-		writerBuilder["indentation"] = "\t";
-		std::unique_ptr<Json::StreamWriter> writer(writerBuilder.newStreamWriter());
-		writer->write(cfg, &out);
-		out.close();
-
 		gi_.Com_PrintFmt("{}: saved updates for {}\n", __FUNCTION__, playerID.c_str());
 	}
 	catch (const std::exception& e) {
@@ -376,13 +504,7 @@ void ClientConfigStore::CreateProfile(gclient_t* client, const std::string& play
 			return;
 
 		const std::string path = *pathOpt;
-		std::ofstream file(path);
-if (file.is_open()) {
-Json::StreamWriterBuilder builder;
-builder["indentation"] = "\t";
-std::unique_ptr<Json::StreamWriter> writer(builder.newStreamWriter());
-writer->write(newFile, &file);
-file.close();
+if (WriteProfile(path, newFile)) {
 gi_.Com_PrintFmt("Created new client config file: {}\n", path);
 }
 else {
@@ -524,18 +646,16 @@ bool ClientConfigStore::LoadProfile(gclient_t* client, const std::string& player
 	}
 
 	const std::string path = *pathOpt;
-	std::ifstream file(path);
+	std::string errs;
+	const ProfileReadResult readResult = ReadProfile(path, playerData, &errs);
 
-	if (!file.is_open()) {
+	if (readResult == ProfileReadResult::Missing) {
 		CreateProfile(client, playerID, playerName, gameType);
 		client->sess.skillRating = kDefaultSkillRating;
 		return false;
 	}
 
-	Json::CharReaderBuilder builder;
-	std::string errs;
-if (!Json::parseFromStream(builder, file, &playerData, &errs)) {
-file.close();
+if (readResult == ProfileReadResult::Invalid) {
 gi_.Com_PrintFmt("Failed to parse client config for {}: {} ({})\n",
 playerName.c_str(), path.c_str(), errs.c_str());
 gi_.Com_PrintFmt("Resetting {} to default configuration and recreating the client config.\n",
@@ -548,7 +668,6 @@ playerName.c_str());
 		CreateProfile(client, playerID, playerName, gameType);
 		return false;
 	}
-	file.close();
 
 	if (playerData.isMember("playerName") && playerData["playerName"].asString() != playerName) {
 		if (!playerData.isMember("originalPlayerName"))
@@ -645,15 +764,7 @@ playerName.c_str());
 
 if (modified) {
 try {
-std::ofstream outFile(path);
-if (outFile.is_open()) {
-				Json::StreamWriterBuilder writerBuilder;
-				writerBuilder["indentation"] = "\t";
-				std::unique_ptr<Json::StreamWriter> writer(writerBuilder.newStreamWriter());
-				writer->write(playerData, &outFile);
-				outFile.close();
-			}
-			else {
+if (!WriteProfile(path, playerData)) {
 gi_.Com_PrintFmt("Failed to write updated config for {}: {}\n", playerName.c_str(), path.c_str());
 }
 }
@@ -721,20 +832,18 @@ bool ClientConfigStore::UpdateConfig(const std::string& playerID, const std::fun
 		return false;
 
 	const std::string path = *pathOpt;
-	std::ifstream in(path);
-if (!in.is_open()) {
-gi_.Com_PrintFmt("{}: failed to open {}\n", __FUNCTION__, path.c_str());
-return false;
-}
-
 	Json::Value cfg;
-	Json::CharReaderBuilder builder;
 	std::string errs;
-if (!Json::parseFromStream(builder, in, &cfg, &errs)) {
-gi_.Com_PrintFmt("{}: parse error in {}: {}\n", __FUNCTION__, path.c_str(), errs.c_str());
-return false;
-}
-	in.close();
+	switch (ReadProfile(path, cfg, &errs)) {
+	case ProfileReadResult::Loaded:
+		break;
+	case ProfileReadResult::Missing:
+		gi_.Com_PrintFmt("{}: failed to open {}\n", __FUNCTION__, path.c_str());
+		return false;
+	case ProfileReadResult::Invalid:
+		gi_.Com_PrintFmt("{}: parse error in {}: {}\n", __FUNCTION__, path.c_str(), errs.c_str());
+		return false;
+	}
 
 	Json::Value before = cfg;
 	updater(cfg);
@@ -748,18 +857,11 @@ return false;
 if (!EnsurePlayerConfigDirectory())
 return false;
 
-std::ofstream out(path);
-if (!out.is_open()) {
+if (!WriteProfile(path, cfg)) {
 gi_.Com_PrintFmt("{}: failed to write {}\n", __FUNCTION__, path.c_str());
 return false;
 }
 
-		Json::StreamWriterBuilder writerBuilder;
-		writerBuilder["indentation"] = "\t";
-		std::unique_ptr<Json::StreamWriter> writer(writerBuilder.newStreamWriter());
-		writer->write(cfg, &out);
-		out.close();
-
 gi_.Com_PrintFmt("{}: saved updates for {}\n", __FUNCTION__, playerID.c_str());
 return true;
 }
@@ -821,15 +923,18 @@ std::string ClientConfigStore::PlayerNameForSocialID(const std::string& socialID
 	if (!pathOpt)
 		return {};
 
-	std::ifstream file(*pathOpt);
-	if (!file.is_open())
-	return {};
+	const std::string& path = *pathOpt;
+	std::filesystem::file_time_type writeTime;
+	std::uintmax_t size = 0;
+	if (!ProfileFileStamp(path, writeTime, size))
+		return {};
 
-	Json::Value root;
-	Json::CharReaderBuilder builder;
-	std::string errs;
+	auto it = profileIndex_.find(path);
+	if (it != profileIndex_.end() && it->second.writeTime == writeTime && it->second.size == size)
+		return it->second.playerName;
 
-	if (!Json::parseFromStream(builder, file, &root, &errs))
+	Json::Value root;
+	if (ReadProfile(path, root) != ProfileReadResult::Loaded)
 		return {};
 
 	if (!root.isMember("playerName") || !root["playerName"].isString())
@@ -47,6 +47,8 @@ void AllocateClientArray(int maxClients) {
 	if (game.clients)
 		FreeClientArray();
 
+	P_InvalidateClientSlotIndex();
+
 	game.maxClients = ClampMaxClients(maxClients);
 
 	if (game.maxClients == 0) {
@@ -58,6 +60,7 @@ void AllocateClientArray(int maxClients) {
 	}
 
 	game.clients = static_cast<gclient_t*>(TagMallocChecked(sizeof(gclient_t) * game.maxClients));
+	game.rosterSkip.fill(0);
 	ConstructClients(game.clients, game.maxClients);
 
 	globals.numEntities = game.maxClients + 1;
@@ -103,6 +106,8 @@ void FreeClientArray() {
 
 	TagFreeChecked(game.lagOrigins);
 
+	P_InvalidateClientSlotIndex();
+
 	game.clients = nullptr;
 	game.lagOrigins = nullptr;
 	game.maxClients = 0;
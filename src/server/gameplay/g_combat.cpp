@@ -113,8 +113,10 @@ void Killed(gentity_t *targ, gentity_t *inflictor, gentity_t *attacker,
   targ->lastMOD = mod;
 
   // [Paril-KEX] monsters call die in their damage handler
-  if (targ->svFlags & SVF_MONSTER)
+  if (targ->svFlags & SVF_MONSTER) {
+    M_RegisterCorpse(targ);
     return;
+  }
 
   targ->die(targ, inflictor, attacker, damage, point, mod);
 
@@ -3381,6 +3381,9 @@ bool Entity_IsVisibleToPlayer(gentity_t* ent, gentity_t* player) {
 	if (index < 0 || index >= MAX_CLIENTS)
 		return false;
 
+	if (ent->interestHiddenFrom[index])
+		return false;
+
 	return !ent->itemPickedUpBy[index];
 }
 
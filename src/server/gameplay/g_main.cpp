@@ -2169,6 +2169,7 @@ Handles timeouts, intermission, entity updates, and respawns.
 */
 static inline void G_RunFrame_(bool main_loop) {
   level.inFrame = true;
+  vis_cache.invalidate();
 
   // --- Timeout Handling ---
   if (level.timeoutActive > 0_ms && level.timeoutOwner) {
@@ -2413,6 +2414,66 @@ static inline bool G_AnyClientsSpawned() {
   return false;
 }
 
+constexpr float SNAPSHOT_INTEREST_DISTANCE = 2048.f;
+constexpr size_t SNAPSHOT_INTEREST_BUDGET = 48;
+
+/*
+=============
+G_UpdateSnapshotInterest
+
+Decides, per client, which FL_LOW_INTEREST entities (gibs and the like)
+go into its next snapshot. Anything beyond the relevance distance is
+dropped, and of the rest only the nearest SNAPSHOT_INTEREST_BUDGET are
+kept. The result is read back by Entity_IsVisibleToPlayer for
+SVF_INSTANCED entities.
+=============
+*/
+static void G_UpdateSnapshotInterest() {
+  static std::vector<gentity_t *> candidates;
+  static std::vector<std::pair<float, gentity_t *>> ranked;
+
+  candidates.clear();
+
+  for (uint32_t i = game.maxClients + 1; i < globals.numEntities; i++) {
+    gentity_t *ent = &g_entities[i];
+
+    if (!ent->inUse || !(ent->flags & FL_LOW_INTEREST))
+      continue;
+
+    ent->interestHiddenFrom.reset();
+    candidates.push_back(ent);
+  }
+
+  if (candidates.empty())
+    return;
+
+  for (auto player : active_clients()) {
+    const size_t index = player->s.number - 1;
+
+    ranked.clear();
+
+    for (gentity_t *ent : candidates) {
+      const float distSq = (ent->s.origin - player->s.origin).lengthSquared();
+
+      if (distSq > SNAPSHOT_INTEREST_DISTANCE * SNAPSHOT_INTEREST_DISTANCE)
+        ent->interestHiddenFrom.set(index);
+      else
+        ranked.emplace_back(distSq, ent);
+    }
+
+    if (ranked.size() <= SNAPSHOT_INTEREST_BUDGET)
+      continue;
+
+    std::nth_element(ranked.begin(), ranked.begin() + SNAPSHOT_INTEREST_BUDGET,
+                     ranked.end(), [](const auto &a, const auto &b) {
+                       return a.first < b.first;
+                     });
+
+    for (size_t i = SNAPSHOT_INTEREST_BUDGET; i < ranked.size(); i++)
+      ranked[i].second->interestHiddenFrom.set(index);
+  }
+}
+
 static inline bool G_AnyClientsConnected() {
   for (size_t i = 0; i < game.maxClients; ++i)
     if (game.clients[i].pers.connected)
@@ -2422,11 +2483,19 @@ static inline bool G_AnyClientsConnected() {
 }
 
 void G_RunFrame(bool main_loop) {
-  if (main_loop && !G_AnyClientsConnected())
+  if (main_loop && !G_AnyClientsConnected()) {
+    G_FlushMuzzleFlashes();
     return;
+  }
 
-  for (size_t i = 0; i < g_framesPerFrame->integer; i++)
+  // muzzle flashes queued by client thinks and this frame go out together
+  for (size_t i = 0; i < g_framesPerFrame->integer; i++) {
     G_RunFrame_(main_loop);
+    G_FlushMuzzleFlashes();
+  }
+
+  // snapshots are built right after we return
+  G_UpdateSnapshotInterest();
 
   // match details.. only bother if there's at least 1 player in-game
   // and not already end of game
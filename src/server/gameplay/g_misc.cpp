@@ -302,6 +302,13 @@ gentity_t* ThrowGib(gentity_t* self, std::string gibname, int damage, gib_type_t
 		gib->s.renderFX |= RF_IR_VISIBLE;
 	}
 	gib->flags |= FL_NO_KNOCKBACK | FL_NO_DAMAGE_EFFECTS;
+
+	// thrown pieces are pure decoration; let the snapshot interest pass cull them
+	if (gib != self) {
+		gib->flags |= FL_LOW_INTEREST;
+		gib->svFlags |= SVF_INSTANCED;
+	}
+
 	gib->takeDamage = true;
 	gib->die = gib_die;
 	gib->className = "gib";
@@ -6,19 +6,15 @@ g_monster.cpp implementation.*/
 #include "../g_local.hpp"
 #include "../bots/bot_includes.hpp"
 
+#include <array>
+#include <bit>
+#include <vector>
+
 //
 // monster weapons
 //
 void monster_muzzleflash(gentity_t* self, const Vector3& start, MonsterMuzzleFlashID id) {
-	gi.WriteByte(id <= 255 ? svc_muzzleflash2 : svc_muzzleflash3);
-	gi.WriteEntity(self);
-
-	if (id <= 255)
-		gi.WriteByte(id);
-	else
-		gi.WriteShort(id);
-
-	gi.multicast(start, MULTICAST_PHS, false);
+	G_MonsterMuzzleFlash(self, start, id);
 }
 
 void monster_fire_bullet(gentity_t* self, const Vector3& start, const Vector3& dir, int damage, int kick, int hSpread,
@@ -771,6 +767,8 @@ void M_ProcessPain(gentity_t* e) {
 	if (!e->monsterInfo.damage.blood)
 		return;
 
+	M_WakeDormant(e);
+
 	if (e->health <= 0) {
 		if (e->monsterInfo.aiFlags & AI_MEDIC) {
 			if (e->enemy && e->enemy->inUse && (e->enemy->svFlags & SVF_MONSTER)) // god, I hope so
@@ -933,6 +931,7 @@ THINK(monster_dead_think) (gentity_t* self) -> void {
 }
 
 void monster_dead(gentity_t* self) {
+	M_RegisterCorpse(self);
 	self->think = monster_dead_think;
 	self->nextThink = level.time + 10_hz;
 	self->timeStamp = level.time + CORPSE_SINK_TIME + 1.5_sec;
@@ -944,6 +943,152 @@ void monster_dead(gentity_t* self) {
 	gi.linkEntity(self);
 }
 
+/*
+=============
+CORPSE REGISTRY
+
+Monsters are registered here when they die so medic searches walk real
+candidates instead of every entity in range. Entries are keyed by entity
+number (so iteration keeps entity order, matching FindRadius) and carry the
+spawn count they were registered under; freed, revived, gibbed-away or
+reused slots are dropped the next time a search passes over them. Wiped on
+level spawn and load, then rebuilt from the entity list on the next search.
+=============
+*/
+namespace {
+constexpr GameTime CORPSE_SIGHT_TIME = 200_ms;
+
+struct CorpseEntry {
+	int32_t spawnCount = 0;
+
+	// last visibility answer, valid for one medic standing still
+	const gentity_t* medic = nullptr;
+	Vector3 medicOrigin{}, corpseOrigin{};
+	GameTime sightUntil = 0_ms;
+	bool visible = false;
+};
+
+struct CorpseRegistry {
+	std::array<uint64_t, MAX_ENTITIES / 64> registered{};
+	std::vector<CorpseEntry> entries;
+	bool valid = false;
+};
+
+CorpseRegistry corpses;
+
+/*
+=============
+M_CorpseRegistryValidate
+=============
+*/
+void M_CorpseRegistryValidate() {
+	if (corpses.valid)
+		return;
+
+	corpses.registered.fill(0);
+	corpses.entries.assign(MAX_ENTITIES, CorpseEntry{});
+	corpses.valid = true;
+
+	for (size_t i = 0; i < globals.numEntities; i++) {
+		gentity_t* ent = &g_entities[i];
+
+		if (ent->inUse && (ent->svFlags & SVF_MONSTER) && ent->health <= 0)
+			M_RegisterCorpse(ent);
+	}
+}
+} // namespace
+
+/*
+=============
+M_RegisterCorpse
+
+Records a dead monster as a possible resurrection target.
+=============
+*/
+void M_RegisterCorpse(gentity_t* ent) {
+	if (!corpses.valid || !ent || !(ent->svFlags & SVF_MONSTER))
+		return;
+
+	const size_t num = ent - g_entities;
+	corpses.registered[num / 64] |= 1ull << (num % 64);
+	corpses.entries[num] = CorpseEntry{ ent->spawn_count };
+}
+
+/*
+=============
+M_InvalidateCorpseRegistry
+=============
+*/
+void M_InvalidateCorpseRegistry() {
+	corpses.valid = false;
+}
+
+/*
+=============
+M_CorpsesInRadius
+
+FindRadius over registered corpses only: fills `list` in entity order with
+dead monsters whose bounds centre is within `rad` of `org`.
+=============
+*/
+size_t M_CorpsesInRadius(const Vector3& org, float rad, gentity_t** list, size_t maxCount) {
+	M_CorpseRegistryValidate();
+
+	size_t count = 0;
+
+	for (size_t word = 0; word < corpses.registered.size() && count < maxCount; word++) {
+		uint64_t bits = corpses.registered[word];
+
+		while (bits && count < maxCount) {
+			const size_t num = word * 64 + std::countr_zero(bits);
+			bits &= bits - 1;
+
+			gentity_t* ent = &g_entities[num];
+
+			if (num >= globals.numEntities || !ent->inUse || ent->spawn_count != corpses.entries[num].spawnCount ||
+				!(ent->svFlags & SVF_MONSTER) || ent->health > 0) {
+				corpses.registered[word] &= ~(1ull << (num % 64));
+				continue;
+			}
+
+			if (ent->solid == SOLID_NOT)
+				continue;
+
+			const Vector3 centre = ent->s.origin + (ent->mins + ent->maxs) * 0.5f;
+			if ((org - centre).length() > rad)
+				continue;
+
+			list[count++] = ent;
+		}
+	}
+
+	return count;
+}
+
+/*
+=============
+M_CorpseVisible
+
+visible() for medic searches, reusing the last answer while neither the
+medic nor the corpse has moved.
+=============
+*/
+bool M_CorpseVisible(gentity_t* medic, gentity_t* corpse) {
+	CorpseEntry& entry = corpses.entries[corpse - g_entities];
+
+	if (entry.medic == medic && level.time < entry.sightUntil &&
+		entry.medicOrigin == medic->s.origin && entry.corpseOrigin == corpse->s.origin)
+		return entry.visible;
+
+	entry.medic = medic;
+	entry.medicOrigin = medic->s.origin;
+	entry.corpseOrigin = corpse->s.origin;
+	entry.sightUntil = level.time + CORPSE_SIGHT_TIME;
+	entry.visible = visible(medic, corpse);
+
+	return entry.visible;
+}
+
 /*
 =============
 projectile_infront
@@ -1002,6 +1147,132 @@ static void M_CheckDodge(gentity_t* self) {
 	gi.BoxEntities(self->absMin - Vector3{ 512, 512, 512 }, self->absMax + Vector3{ 512, 512, 512 }, nullptr, 0, AREA_SOLID, M_CheckDodge_BoxEntitiesFilter, self);
 }
 
+constexpr GameTime MONSTER_DORMANT_CHECK = 250_ms;
+
+/*
+=============
+M_AlertPending
+
+True while a player noise or monster alert this monster could pick up is
+still fresh. FindTarget only reads those for a frame, so a monster woken
+by one must not park again before its stand think has looked at it.
+=============
+*/
+static bool M_AlertPending(gentity_t* self) {
+	auto fresh = [self](const gentity_t* source, GameTime time) {
+		return source && time >= level.time - FRAME_TIME_S && gi.inPHS(self->s.origin, source->s.origin, true);
+	};
+
+	for (auto player : active_clients()) {
+		const gclient_t* cl = player->client;
+
+		if (fresh(cl->sound_entity, cl->sound_entity_time) ||
+			fresh(cl->sound2_entity, cl->sound2_entity_time) ||
+			fresh(cl->sight_entity, cl->sight_entity_time))
+			return true;
+	}
+
+	return false;
+}
+
+/*
+=============
+M_CanGoDormant
+
+Idle monsters looping a stand animation with no enemy, goal or pending
+move can be parked while no client could see or hear them.
+=============
+*/
+static bool M_CanGoDormant(gentity_t* self) {
+	if (globals.serverFlags & SERVER_FLAG_LOADING)
+		return false;
+
+	if (self->health <= 0 || self->deadFlag || self->enemy || self->goalEntity || self->moveTarget)
+		return false;
+
+	if (self->monsterInfo.aiFlags & (AI_GOOD_GUY | AI_SOUND_TARGET | AI_COMBAT_POINT | AI_ALTERNATE_FLY | AI_HIGH_TICK_RATE | AI_MEDIC))
+		return false;
+
+	if (self->groundEntity != world || self->velocity || self->aVelocity)
+		return false;
+
+	if (self->waterType & (CONTENTS_LAVA | CONTENTS_SLIME))
+		return false;
+
+	if (self->monsterInfo.pauseTime <= level.time)
+		return false;
+
+	const MonsterMove* move = self->monsterInfo.active_move.pointer();
+
+	if (!move || move->endFunc)
+		return false;
+
+	if (self->monsterInfo.next_move.pointer() && self->monsterInfo.next_move != self->monsterInfo.active_move)
+		return false;
+
+	if (self->s.frame < move->firstFrame || self->s.frame > move->lastFrame)
+		return false;
+
+	for (int32_t i = 0; i <= move->lastFrame - move->firstFrame; i++)
+		if (move->frame[i].aiFunc != ai_stand || move->frame[i].dist || move->frame[i].thinkFunc)
+			return false;
+
+	for (auto player : active_clients())
+		if (gi.inPHS(self->s.origin, player->s.origin, true))
+			return false;
+
+	return !M_AlertPending(self);
+}
+
+/*
+=============
+M_WakeDormant
+
+Brings a parked monster back to full rate. The stand loop is advanced by
+the 10hz steps it missed, so the result only depends on elapsed time.
+=============
+*/
+void M_WakeDormant(gentity_t* self) {
+	if (!self->monsterInfo.dormantTime)
+		return;
+
+	const MonsterMove* move = self->monsterInfo.active_move.pointer();
+
+	if (move && !(self->monsterInfo.aiFlags & AI_HOLD_FRAME) &&
+		self->s.frame >= move->firstFrame && self->s.frame <= move->lastFrame) {
+		const int64_t steps = (level.time - self->monsterInfo.dormantTime).milliseconds() / (10_hz).milliseconds();
+		const int64_t count = move->lastFrame - move->firstFrame + 1;
+
+		self->s.frame = move->firstFrame + static_cast<int32_t>((self->s.frame - move->firstFrame + steps) % count);
+	}
+
+	self->monsterInfo.dormantTime = 0_ms;
+	self->monsterInfo.next_move_time = level.time;
+	self->nextThink = level.time;
+}
+
+/*
+=============
+M_WakeDormantAround
+
+Wakes parked monsters that could hear or see something happening at
+`origin`. Player noises and monster alerts are only readable for a frame,
+much shorter than the dormancy recheck, so whoever raises one has to do
+the waking.
+=============
+*/
+void M_WakeDormantAround(const Vector3& origin) {
+	for (uint32_t i = game.maxClients + 1; i < globals.numEntities; i++) {
+		gentity_t* ent = &g_entities[i];
+
+		if (!ent->inUse || !(ent->svFlags & SVF_MONSTER) || !ent->monsterInfo.dormantTime)
+			continue;
+
+		if (gi.inPHS(origin, ent->s.origin, true))
+			M_WakeDormant(ent);
+	}
+}
+
 static bool CheckPathVisibility(const Vector3& start, const Vector3& end) {
 	trace_t tr = gi.traceLine(start, end, nullptr, MASK_SOLID | CONTENTS_PROJECTILECLIP | CONTENTS_MONSTERCLIP | CONTENTS_PLAYERCLIP);
 
@@ -1127,6 +1398,20 @@ THINK(monster_think) (gentity_t* self) -> void {
 		}
 	}
 
+	// park idle monsters nobody can see or hear; only try on a 10hz
+	// frame boundary so waking can fast-forward whole frames
+	if (self->monsterInfo.dormantTime || self->monsterInfo.next_move_time <= level.time) {
+		if (M_CanGoDormant(self)) {
+			if (!self->monsterInfo.dormantTime)
+				self->monsterInfo.dormantTime = level.time;
+
+			self->nextThink = level.time + MONSTER_DORMANT_CHECK;
+			return;
+		}
+
+		M_WakeDormant(self);
+	}
+
 	if (self->health > 0 && self->monsterInfo.dodge && !(globals.serverFlags & SERVER_FLAG_LOADING))
 		M_CheckDodge(self);
 
@@ -1595,6 +1880,8 @@ void monster_start_go(gentity_t* self) {
 		if (!self->inUse)
 			return;
 
+		M_RegisterCorpse(self);
+
 		if (self->monsterInfo.setSkin)
 			self->monsterInfo.setSkin(self);
 
@@ -12,6 +12,7 @@ process. - Visual Effects: Contains the logic for the "spawngrow" effect, a visu
 plays where a monster is about to materialize.*/
 
 #include <cmath>
+#include <unordered_map>
 
 #include "../g_local.hpp"
 
@@ -115,6 +116,94 @@ gentity_t* CreateGroundMonster(const Vector3& origin, const Vector3& angles, con
 	return newEnt;
 }
 
+/*
+=============
+PLACEMENT CACHE
+
+Bosses and Horde ask FindSpawnPoint for the same reinforcement slots over
+and over, usually a frame or two apart. Results are remembered per start
+cell, hull and search mode for the rest of the level. A found spot is only
+handed out again for the exact start point that produced it (the search
+result depends on where it starts, not just the cell), and is re-verified
+with a box check (plus a floor check when dropping) first. Failures are
+shared across the cell but only trusted for a short while, since they are
+often caused by something standing in the way.
+=============
+*/
+namespace {
+constexpr float PLACEMENT_CELL_SIZE = 8.f;
+constexpr GameTime PLACEMENT_FAILURE_TIME = 300_ms;
+constexpr size_t MAX_PLACEMENTS = 4096;
+
+struct PlacementKey {
+	std::array<int32_t, 3> cell;
+	Vector3 mins, maxs, gravity;
+	float maxMoveUp;
+	bool drop, ceiling;
+
+	bool operator==(const PlacementKey&) const = default;
+};
+
+struct PlacementKeyHash {
+	size_t operator()(const PlacementKey& key) const noexcept {
+		size_t hash = 0;
+		auto mix = [&hash](size_t value) {
+			hash ^= value + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+		};
+		for (int i = 0; i < 3; i++) {
+			mix(std::hash<int32_t>{}(key.cell[i]));
+			mix(std::hash<float>{}(key.mins[i]));
+			mix(std::hash<float>{}(key.maxs[i]));
+			mix(std::hash<float>{}(key.gravity[i]));
+		}
+		mix(std::hash<float>{}(key.maxMoveUp));
+		mix(static_cast<size_t>(key.drop) << 1 | key.ceiling);
+		return hash;
+	}
+};
+
+struct Placement {
+	bool found = false;
+	Vector3 start{};
+	Vector3 point{};
+	GameTime retryTime = 0_ms; // failures only
+};
+
+std::unordered_map<PlacementKey, Placement, PlacementKeyHash> placements;
+
+/*
+=============
+PlacementStillValid
+
+Cheap re-check of a remembered spot: the hull must still fit and, for
+dropped placements, something must still be directly underfoot.
+=============
+*/
+bool PlacementStillValid(const Vector3& point, const Vector3& mins, const Vector3& maxs, const Vector3& gravity, bool drop, bool ceiling) {
+	if (!CheckSpawnPoint(point, mins, maxs))
+		return false;
+
+	if (!drop)
+		return true;
+
+	const Vector3 dropDir = ceiling ? -gravity : gravity;
+	const trace_t floor = gi.trace(point, mins, maxs, point + (dropDir * 2.f), nullptr, MASK_MONSTERSOLID);
+
+	return floor.fraction < 1.0f && !floor.startSolid;
+}
+} // namespace
+
+/*
+=============
+ClearSpawnPointCache
+=============
+*/
+void ClearSpawnPointCache() {
+	placements.clear();
+}
+
+static bool FindSpawnPoint_Search(const Vector3& startpoint, const Vector3& mins, const Vector3& maxs, Vector3& spawnpoint, float maxMoveUp, bool drop, bool ceiling, const Vector3& gravity);
+
 // FindSpawnPoint
 // PMM - this is used by the medic commander (possibly by the carrier) to find a good spawn point
 // if the startpoint is bad, try above the startpoint for a bit
@@ -127,6 +216,57 @@ FindSpawnPoint
 bool FindSpawnPoint(const Vector3& startpoint, const Vector3& mins, const Vector3& maxs, Vector3& spawnpoint, float maxMoveUp, bool drop, bool ceiling) {
 	const Vector3 gravity = GetSpawnGravity();
 
+	PlacementKey key{};
+	for (int i = 0; i < 3; i++)
+		key.cell[i] = static_cast<int32_t>(std::floor(startpoint[i] / PLACEMENT_CELL_SIZE));
+	key.mins = mins;
+	key.maxs = maxs;
+	key.gravity = gravity;
+	key.maxMoveUp = maxMoveUp;
+	key.drop = drop;
+	key.ceiling = ceiling;
+
+	if (auto it = placements.find(key); it != placements.end()) {
+		const Placement& placement = it->second;
+
+		if (!placement.found && level.time < placement.retryTime) {
+			spawnpoint = startpoint;
+			return false;
+		}
+
+		// a clear start is what the search would return first anyway
+		if (placement.found && !drop && CheckSpawnPoint(startpoint, mins, maxs)) {
+			spawnpoint = startpoint;
+			return true;
+		}
+
+		if (placement.found && placement.start == startpoint && PlacementStillValid(placement.point, mins, maxs, gravity, drop, ceiling)) {
+			spawnpoint = placement.point;
+			return true;
+		}
+	}
+
+	Placement placement{};
+	placement.found = FindSpawnPoint_Search(startpoint, mins, maxs, spawnpoint, maxMoveUp, drop, ceiling, gravity);
+	placement.start = startpoint;
+	placement.point = spawnpoint;
+	placement.retryTime = level.time + PLACEMENT_FAILURE_TIME;
+
+	if (placements.size() >= MAX_PLACEMENTS)
+		placements.clear();
+	placements.insert_or_assign(key, placement);
+
+	return placement.found;
+}
+
+/*
+=============
+FindSpawnPoint_Search
+
+The full drop / unstick / step-up search behind the placement cache.
+=============
+*/
+static bool FindSpawnPoint_Search(const Vector3& startpoint, const Vector3& mins, const Vector3& maxs, Vector3& spawnpoint, float maxMoveUp, bool drop, bool ceiling, const Vector3& gravity) {
 	auto TryDrop = [mins, maxs, drop, ceiling, gravity](const Vector3& point, Vector3& out) {
 		out = point;
 
@@ -190,6 +190,137 @@ PUSHMOVE
 ===============================================================================
 */
 
+/*
+===============================================================================
+
+MISSILE PATHS
+
+Fly missiles travel in a straight line, so the static world along the line
+only has to be traced once. Movers and other brush entities are entities, not
+world, so they are still picked up by the per-frame entity check.
+
+===============================================================================
+*/
+
+constexpr float MISSILE_PATH_HORIZON = 8192.f;
+constexpr float MISSILE_PATH_MARGIN = 1.f;
+
+/*
+=============
+G_MissilePathBlocker
+
+Finds anything in the swept box that the missile's trace could hit,
+ignoring itself, its owner and its own projectiles the way the trace does.
+=============
+*/
+static BoxEntitiesResult_t G_MissilePathBlocker(gentity_t* other, void* data) {
+	gentity_t* ent = (gentity_t*)data;
+
+	if (other == ent || other == ent->owner || (other->owner && other->owner == ent))
+		return BoxEntitiesResult_t::Skip;
+
+	const contents_t mask = ent->missilePath.mask;
+
+	if ((other->svFlags & SVF_PROJECTILE) && !(mask & CONTENTS_PROJECTILE))
+		return BoxEntitiesResult_t::Skip;
+
+	if ((other->svFlags & SVF_DEADMONSTER) && !(mask & CONTENTS_DEADMONSTER))
+		return BoxEntitiesResult_t::Skip;
+
+	return BoxEntitiesResult_t::Keep | BoxEntitiesResult_t::End;
+}
+
+/*
+=============
+G_MissilePathValid
+
+The cached world sweep only holds while the missile keeps the exact line,
+hull and mask it was computed for.
+=============
+*/
+static bool G_MissilePathValid(const gentity_t* ent, const contents_t mask) {
+	const auto& path = ent->missilePath;
+
+	return path.valid && path.origin == ent->s.origin && path.velocity == ent->velocity &&
+		path.mins == ent->mins && path.maxs == ent->maxs && path.mask == mask;
+}
+
+/*
+=============
+G_MissileTrace
+
+Traces a fly missile's push. While the segment stays short of the cached
+world impact and no entity is in the way, the result is known to be clear
+without a world trace; anything else falls back to a real one so hit
+results are unchanged. The world sweep is only built once the missile has
+kept the same velocity for two pushes, so homing or guided missiles never
+pay for one.
+=============
+*/
+static trace_t G_MissileTrace(gentity_t* ent, const Vector3& start, const Vector3& end, const contents_t mask) {
+	auto& path = ent->missilePath;
+
+	if (!G_MissilePathValid(ent, mask)) {
+		const bool steady = path.velocity == ent->velocity;
+
+		path.valid = false;
+		path.velocity = ent->velocity;
+
+		const float speed = ent->velocity.length();
+
+		if (steady && speed > 0.f) {
+			const Vector3 dir = ent->velocity / speed;
+			const trace_t world_tr = gi.clip(world, start, ent->mins, ent->maxs, start + dir * MISSILE_PATH_HORIZON, mask);
+
+			if (!world_tr.startSolid && !world_tr.allSolid) {
+				path.valid = true;
+				path.mins = ent->mins;
+				path.maxs = ent->maxs;
+				path.mask = mask;
+				path.clearEnd = world_tr.endPos;
+			}
+		}
+	}
+
+	if (!path.valid)
+		return gi.trace(start, ent->mins, ent->maxs, end, ent, mask);
+
+	const Vector3 delta = end - start;
+	const float move = delta.length();
+
+	// near the world impact; the sweep has nothing more to offer
+	if (move <= 0.f || (path.clearEnd - end).dot(delta / move) <= MISSILE_PATH_MARGIN) {
+		path.valid = false;
+		return gi.trace(start, ent->mins, ent->maxs, end, ent, mask);
+	}
+
+	Vector3 absmin, absmax;
+	ClearBounds(absmin, absmax);
+	AddPointToBounds(start + ent->mins, absmin, absmax);
+	AddPointToBounds(start + ent->maxs, absmin, absmax);
+	AddPointToBounds(end + ent->mins, absmin, absmax);
+	AddPointToBounds(end + ent->maxs, absmin, absmax);
+
+	if (!gi.BoxEntities(absmin, absmax, nullptr, 0, AREA_SOLID, G_MissilePathBlocker, ent)) {
+		trace_t tr{};
+		tr.fraction = 1.0f;
+		tr.endPos = end;
+		tr.ent = world;
+		path.origin = end;
+		return tr;
+	}
+
+	// something is nearby; trace for real, but a clear result keeps the sweep
+	trace_t tr = gi.trace(start, ent->mins, ent->maxs, end, ent, mask);
+
+	if (tr.fraction == 1.0f && !tr.startSolid)
+		path.origin = end;
+	else
+		path.valid = false;
+
+	return tr;
+}
+
 /*
 ============
 G_PushEntity
@@ -200,8 +331,11 @@ Does not change the entities velocity at all
 static trace_t G_PushEntity(gentity_t* ent, const Vector3& push) {
 	Vector3 start = ent->s.origin;
 	Vector3 end = start + push;
+	const contents_t mask = G_GetClipMask(ent);
 
-	trace_t trace = gi.trace(start, ent->mins, ent->maxs, end, ent, G_GetClipMask(ent));
+	trace_t trace = ent->moveType == MoveType::FlyMissile ?
+		G_MissileTrace(ent, start, end, mask) :
+		gi.trace(start, ent->mins, ent->maxs, end, ent, mask);
 
 	ent->s.origin = trace.endPos + (trace.plane.normal * .5f);
 	gi.linkEntity(ent);
@@ -986,6 +1120,64 @@ static inline void G_RunBmodelAnimation(gentity_t* ent) {
 
 //============================================================================
 
+/*
+=============
+G_PhysicsCanSleep
+
+Toss and step entities resting on solid ground with no velocity, no water
+and nothing attached have no physics to run until something disturbs them.
+=============
+*/
+static bool G_PhysicsCanSleep(const gentity_t* ent) {
+	switch (ent->moveType) {
+		using enum MoveType;
+	case Toss:
+	case Bounce:
+	case Step:
+		break;
+	default:
+		return false;
+	}
+
+	if (!ent->groundEntity || !ent->groundEntity->inUse || ent->gravity <= 0.0f)
+		return false;
+
+	if (ent->velocity || ent->aVelocity)
+		return false;
+
+	if (ent->waterLevel || (ent->waterType & MASK_WATER))
+		return false;
+
+	if (ent->preThink || ent->postThink || ent->bmodel_anim.enabled || ent->teamChain || (ent->flags & FL_TEAMSLAVE))
+		return false;
+
+	return true;
+}
+
+/*
+=============
+G_PhysicsStillAsleep
+
+A sleeping entity wakes when its think comes due, it gains velocity
+(knockback, pushes), it was moved or relinked by someone else, or its
+ground changed, moved or was freed.
+=============
+*/
+static bool G_PhysicsStillAsleep(const gentity_t* ent) {
+	const auto& sleep = ent->physicsSleep;
+
+	if (ent->nextThink > 0_ms && ent->nextThink <= level.time)
+		return false;
+
+	if (ent->velocity || ent->aVelocity)
+		return false;
+
+	if (ent->groundEntity != sleep.ground || !sleep.ground->inUse)
+		return false;
+
+	return ent->linkCount == sleep.linkCount && ent->s.origin == sleep.origin;
+}
+
 /*
 ================
 G_RunEntity
@@ -1000,6 +1192,13 @@ void G_RunEntity(gentity_t* ent) {
 	if (level.timeoutActive)
 		return;
 
+	if (ent->physicsSleep.asleep) {
+		if (G_PhysicsStillAsleep(ent))
+			return;
+
+		ent->physicsSleep.asleep = false;
+	}
+
 	if (ent->moveType == MoveType::Step) {
 		previousOrigin = ent->s.origin;
 		has_previousOrigin = true;
@@ -1076,4 +1275,11 @@ void G_RunEntity(gentity_t* ent) {
 
 	if (ent->postThink)
 		ent->postThink(ent);
+
+	if (ent->inUse && G_PhysicsCanSleep(ent)) {
+		ent->physicsSleep.asleep = true;
+		ent->physicsSleep.origin = ent->s.origin;
+		ent->physicsSleep.ground = ent->groundEntity;
+		ent->physicsSleep.linkCount = ent->linkCount;
+	}
 }
@@ -622,6 +622,16 @@ SAVE_STRUCT_END
 
 MAKE_STRUCT_SAVE_DEDUCER(LevelEntry);
 
+#define DECLARE_SAVE_STRUCT PlayerTrailPoint
+SAVE_STRUCT_START
+FIELD_AUTO(origin),
+FIELD_AUTO(yaw),
+FIELD_AUTO(time)
+SAVE_STRUCT_END
+#undef DECLARE_SAVE_STRUCT
+
+MAKE_STRUCT_SAVE_DEDUCER(PlayerTrailPoint);
+
 // clang-format off
 #define DECLARE_SAVE_STRUCT GameLocals
 SAVE_STRUCT_START
@@ -866,8 +876,9 @@ FIELD_AUTO(trackerPainTime),
 // ownedSphere is DM only
 
 FIELD_AUTO(emptyClickSound),
-FIELD_AUTO(trail_head),
-FIELD_AUTO(trail_tail),
+FIELD_AUTO(trail.points),
+FIELD_AUTO(trail.head),
+FIELD_AUTO(trail.count),
 
 FIELD_GAME_STRING(landmark_name),
 FIELD_AUTO(landmark_rel_pos),
@@ -1166,6 +1177,7 @@ FIELD_AUTO(monsterInfo.strafe_check_time),
 FIELD_AUTO(monsterInfo.base_health),
 FIELD_AUTO(monsterInfo.health_scaling),
 FIELD_AUTO(monsterInfo.next_move_time),
+FIELD_AUTO(monsterInfo.dormantTime),
 FIELD_AUTO(monsterInfo.bad_move_time),
 FIELD_AUTO(monsterInfo.bump_time),
 FIELD_AUTO(monsterInfo.random_change_time),
@@ -1209,8 +1221,6 @@ FIELD_AUTO(offset),
 FIELD_AUTO(gravityVector).set_is_empty(edict_t_gravityVector_is_empty),
 FIELD_AUTO(bad_area),
 FIELD_AUTO(hint_chain),
-FIELD_AUTO(monster_hint_chain),
-FIELD_AUTO(target_hint_chain),
 FIELD_AUTO(hint_chain_id),
 
 FIELD_AUTO(clock_message),
@@ -2564,6 +2574,7 @@ void ReadLevelJson(const char* jsonString) {
 	// wipe all the entities
 	memset(g_entities, 0, game.maxEntities * sizeof(g_entities[0]));
 	globals.numEntities = game.maxClients + 1;
+	M_InvalidateCorpseRegistry();
 
 	// read level
 	json_push_stack("level");
@@ -2626,6 +2637,7 @@ void ReadLevelJson(const char* jsonString) {
 	cached_imageIndex::reset_all();
 
 	G_LoadShadowLights();
+	G_LoadHintPaths();
 }
 
 // [Paril-KEX]
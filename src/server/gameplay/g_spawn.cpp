@@ -5,9 +5,9 @@ g_spawn.cpp (Game Entity Spawning) This file is responsible for parsing the
 entity data from a loaded map and spawning the corresponding entities into the
 game world. It acts as the bridge between the map editor's entity definitions
 and the in-game objects. Key Responsibilities: - Entity Parsing: The
-`ED_ParseEntity` function reads the key/value pairs for each entity from the
-map's entity string. - Field Mapping: `ED_ParseField` maps the text-based keys
-from the map data (e.g., "health", "speed") to the appropriate fields in the
+`ED_CompileEntity` function reads the key/value pairs for each entity from the
+map's entity string into a cached lump. - Field Mapping: `ED_ResolveField` maps
+the text-based keys from the map data (e.g., "health", "speed") to the appropriate fields in the
 `gentity_t` and `spawn_temp_t` structs. - Spawn Function Dispatch:
 `ED_CallSpawn` is the central function that looks up an entity's `className` in
 a dispatch table and calls the correct `SP_*` spawn function to initialize it. -
@@ -30,8 +30,11 @@ global game rules.*/
 #include <format>
 #include <memory>
 #include <new>
+#include <string_view>
 #include <type_traits>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 
 extern gentity_t *neutralObelisk;
@@ -1323,74 +1326,106 @@ static const std::initializer_list<temp_field_t> temp_fields = {
 // clang-format on
 
 /*
-===============
-ED_ParseField
+===============================================================================
 
-Takes a key/value pair and sets the binary values
-in an entity
-===============
+ENTITY LUMP CACHE
+
+Entity strings are tokenized once into per-entity key/value records with the
+spawn field already resolved, and kept keyed by map name and a hash of the
+effective entity string (overrides included). Loading the same map again on
+rotation, or reloading it for a round reset, skips both the tokenizer and the
+field name lookups.
+
+===============================================================================
 */
-static void ED_ParseField(const char *key, const char *value, gentity_t *ent) {
 
-  // check st first
-  for (auto &f : temp_fields) {
-    if (Q_strcasecmp(f.name, key))
-      continue;
+enum class EntityKeyKind : uint8_t {
+  Temp,    // spawn_temp_t field, index into temp_fields
+  Entity,  // gentity_t field, index into entity_fields
+  Color,   // [Sam-KEX] "_color" on shadow-casting lights
+  Unknown
+};
 
-    st.keys_specified.emplace(f.name);
+struct EntityKey {
+  EntityKeyKind kind = EntityKeyKind::Unknown;
+  uint16_t field = 0;
+  std::string key;
+  std::string value;
+};
 
-    // found it
-    if (f.load_func)
-      f.load_func(&st, value);
+struct EntityRecord {
+  bool init = false; // had at least one key/value pair, comments included
+  std::vector<EntityKey> keys;
+};
 
-    return;
-  }
+struct EntityLump {
+  std::string mapName;
+  uint64_t hash = 0;
+  size_t length = 0;
+  std::vector<EntityRecord> entities;
+};
 
-  // now entity
-  for (auto &f : entity_fields) {
-    if (Q_strcasecmp(f.name, key))
-      continue;
+constexpr size_t MAX_CACHED_ENTITY_LUMPS = 8;
+static std::vector<std::shared_ptr<const EntityLump>> entityLumpCache;
 
-    st.keys_specified.emplace(f.name);
+/*
+===============
+ED_HashEntityString
+===============
+*/
+static uint64_t ED_HashEntityString(std::string_view data) {
+  uint64_t hash = 14695981039346656037ull;
+  for (unsigned char c : data) {
+    hash ^= c;
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
 
-    // [Paril-KEX]
-    if (!strcmp(f.name, "bmodel_anim_start") ||
-        !strcmp(f.name, "bmodel_anim_end"))
-      ent->bmodel_anim.enabled = true;
+/*
+===============
+ED_ResolveField
 
-    // found it
-    if (f.load_func)
-      f.load_func(ent, value);
+Maps a spawn key to the field that will load it.
+===============
+*/
+static void ED_ResolveField(EntityKey &key) {
+  uint16_t index = 0;
+  for (auto &f : temp_fields) {
+    if (!Q_strcasecmp(f.name, key.key.c_str())) {
+      key.kind = EntityKeyKind::Temp;
+      key.field = index;
+      return;
+    }
+    index++;
+  }
 
-    return;
+  index = 0;
+  for (auto &f : entity_fields) {
+    if (!Q_strcasecmp(f.name, key.key.c_str())) {
+      key.kind = EntityKeyKind::Entity;
+      key.field = index;
+      return;
+    }
+    index++;
   }
 
-  worr::Logf(worr::LogLevel::Trace, "{}: unknown spawn key \"{}\" for {}",
-             __FUNCTION__, key, LogEntityLabel(ent));
+  key.kind = EntityKeyKind::Unknown;
 }
 
 /*
 ====================
-ED_ParseEntity
+ED_CompileEntity
 
-Parses an entity out of the given string, returning the new position
-ed should be a properly initialized empty entity.
+Tokenizes one entity's key/value pairs, returning the new position.
 ====================
 */
-static const char *ED_ParseEntity(const char *data, gentity_t *ent) {
-  bool init;
+static const char *ED_CompileEntity(const char *data, EntityRecord &record) {
   char keyname[256];
   char value[MAX_TOKEN_CHARS];
   bool truncated = false;
   const char *com_token;
 
-  init = false;
-  st = {};
-
-  const int32_t ent_num = static_cast<int32_t>(ent - g_entities);
-  worr::Logf(worr::LogLevel::Trace, "{}: parsing entity #{}", __FUNCTION__,
-             ent_num);
-
   // go through all the dictionary pairs
   while (1) {
     // parse key
@@ -1402,7 +1437,7 @@ static const char *ED_ParseEntity(const char *data, gentity_t *ent) {
     if (com_token[0] == '}')
       break;
     if (!data)
-      gi.Com_Error("ED_ParseEntity: EOF without closing brace");
+      gi.Com_Error("ED_CompileEntity: EOF without closing brace");
 
     // parse value
     truncated = false;
@@ -1411,27 +1446,144 @@ static const char *ED_ParseEntity(const char *data, gentity_t *ent) {
       gi.Com_ErrorFmt("{}: value for key \"{}\" exceeded {} chars.\n",
                       __FUNCTION__, keyname, sizeof(value) - 1);
     if (!data)
-      gi.Com_Error("ED_ParseEntity: EOF without closing brace");
+      gi.Com_Error("ED_CompileEntity: EOF without closing brace");
 
     if (com_token[0] == '}')
-      gi.Com_Error("ED_ParseEntity: closing brace without data");
+      gi.Com_Error("ED_CompileEntity: closing brace without data");
 
-    init = true;
+    record.init = true;
 
     // keynames with a leading underscore are used for utility comments,
     // and are immediately discarded by quake
     if (keyname[0] == '_') {
-      // [Sam-KEX] Hack for setting RGBA for shadow-casting lights
       if (!strcmp(keyname, "_color"))
-        ent->s.skinNum = ED_LoadColor(com_token);
+        record.keys.push_back({EntityKeyKind::Color, 0, keyname, com_token});
+
+      continue;
+    }
+
+    EntityKey &key = record.keys.emplace_back();
+    key.key = keyname;
+    key.value = com_token;
+    ED_ResolveField(key);
+  }
+
+  return data;
+}
+
+/*
+====================
+ED_CompileEntityLump
+====================
+*/
+static std::shared_ptr<EntityLump> ED_CompileEntityLump(const char *entities) {
+  auto lump = std::make_shared<EntityLump>();
+
+  while (true) {
+    const char *token = COM_Parse(&entities);
+    if (!entities)
+      break;
+
+    if (token[0] != '{') {
+      gi.Com_ErrorFmt("{}: Found \"{}\" when expecting {{ in entity string.\n",
+                      __FUNCTION__, token);
+    }
+
+    entities = ED_CompileEntity(entities, lump->entities.emplace_back());
+  }
+
+  return lump;
+}
+
+/*
+====================
+ED_GetEntityLump
 
+Fetches the compiled form of an entity string, compiling and caching it on
+a miss. The most recently used lumps are kept at the front.
+====================
+*/
+static std::shared_ptr<const EntityLump> ED_GetEntityLump(const char *mapName,
+                                                          const std::string &entities) {
+  const uint64_t hash = ED_HashEntityString(entities);
+
+  for (auto it = entityLumpCache.begin(); it != entityLumpCache.end(); ++it) {
+    const auto &lump = *it;
+    if (lump->hash != hash || lump->length != entities.size() ||
+        lump->mapName != mapName)
       continue;
+
+    std::shared_ptr<const EntityLump> found = lump;
+    entityLumpCache.erase(it);
+    entityLumpCache.insert(entityLumpCache.begin(), found);
+    worr::Logf(worr::LogLevel::Debug, "{}: reusing compiled entities for {}",
+               __FUNCTION__, mapName);
+    return found;
+  }
+
+  auto lump = ED_CompileEntityLump(entities.c_str());
+  lump->mapName = mapName;
+  lump->hash = hash;
+  lump->length = entities.size();
+
+  if (entityLumpCache.size() >= MAX_CACHED_ENTITY_LUMPS)
+    entityLumpCache.pop_back();
+  entityLumpCache.insert(entityLumpCache.begin(), lump);
+
+  return lump;
+}
+
+/*
+====================
+ED_ApplyEntity
+
+Loads a compiled entity's key/value pairs into the given entity.
+ed should be a properly initialized empty entity.
+====================
+*/
+static void ED_ApplyEntity(const EntityRecord &record, gentity_t *ent) {
+  st = {};
+
+  const int32_t ent_num = static_cast<int32_t>(ent - g_entities);
+  worr::Logf(worr::LogLevel::Trace, "{}: parsing entity #{}", __FUNCTION__,
+             ent_num);
+
+  for (const EntityKey &key : record.keys) {
+    switch (key.kind) {
+    case EntityKeyKind::Temp: {
+      const temp_field_t &f = *(temp_fields.begin() + key.field);
+
+      st.keys_specified.emplace(f.name);
+
+      if (f.load_func)
+        f.load_func(&st, key.value.c_str());
+      break;
     }
+    case EntityKeyKind::Entity: {
+      const field_t &f = *(entity_fields.begin() + key.field);
+
+      st.keys_specified.emplace(f.name);
 
-    ED_ParseField(keyname, com_token, ent);
+      // [Paril-KEX]
+      if (!strcmp(f.name, "bmodel_anim_start") ||
+          !strcmp(f.name, "bmodel_anim_end"))
+        ent->bmodel_anim.enabled = true;
+
+      if (f.load_func)
+        f.load_func(ent, key.value.c_str());
+      break;
+    }
+    case EntityKeyKind::Color:
+      ent->s.skinNum = ED_LoadColor(key.value.c_str());
+      break;
+    case EntityKeyKind::Unknown:
+      worr::Logf(worr::LogLevel::Trace, "{}: unknown spawn key \"{}\" for {}",
+                 __FUNCTION__, key.key, LogEntityLabel(ent));
+      break;
+    }
   }
 
-  if (!init) {
+  if (!record.init) {
     ent->~gentity_t();
     new (ent) gentity_t();
   }
@@ -1439,8 +1591,6 @@ static const char *ED_ParseEntity(const char *data, gentity_t *ent) {
   const char *parsed_class = ent->className ? ent->className : "<unset>";
   worr::Logf(worr::LogLevel::Trace, "{}: parsed entity #{} as {} ({} keys)",
              __FUNCTION__, ent_num, parsed_class, st.keys_specified.size());
-
-  return data;
 }
 
 /*
@@ -2085,7 +2235,16 @@ static const char *TryLoadEntityOverride(const char *mapName,
         std::vector<char> buffer(size + 1);
         if (in.read(buffer.data(), size)) {
           buffer[size] = '\0';
-          if (VerifyEntityString(buffer.data())) {
+
+          // overrides only need verifying the first time their contents are seen
+          static std::unordered_set<uint64_t> verifiedOverrides;
+          const uint64_t overrideHash = ED_HashEntityString(
+              std::string_view(buffer.data(), static_cast<size_t>(size)));
+          const bool verified = verifiedOverrides.contains(overrideHash) ||
+                                VerifyEntityString(buffer.data());
+
+          if (verified) {
+            verifiedOverrides.insert(overrideHash);
             if (g_verbose->integer)
               gi.Com_PrintFmt(
                   "{}: Entities override file verified and loaded: \"{}\"\n",
@@ -2156,8 +2315,12 @@ void SpawnEntities(const char *mapName, const char *entities,
 
   // Clear cached asset indices
   cached_soundIndex::clear_all();
+  vis_cache.invalidate();
   cached_modelIndex::clear_all();
   cached_imageIndex::clear_all();
+  M_ClearSupportCache();
+  ClearSpawnPointCache();
+  M_InvalidateCorpseRegistry();
 
   // Reset all persistent game state
   SaveClientData();
@@ -2196,7 +2359,6 @@ void SpawnEntities(const char *mapName, const char *entities,
   level.campaign.coopHealthScaling =
       std::clamp(g_coop_health_scaling->value, 0.0f, 1.0f);
   level.savedEntityString = std::move(entityStringStorage);
-  entities = level.savedEntityString.c_str();
 
   // Initialize all client structs
   for (size_t i = 0; i < game.maxClients; ++i) {
@@ -2208,17 +2370,9 @@ void SpawnEntities(const char *mapName, const char *entities,
   }
   int inhibited = 0;
   gentity_t *ent = nullptr;
+  const auto lump = ED_GetEntityLump(level.mapName.data(), level.savedEntityString);
 
-  while (true) {
-    const char *token = COM_Parse(&entities);
-    if (!entities)
-      break;
-
-    if (token[0] != '{') {
-      gi.Com_ErrorFmt("{}: Found \"{}\" when expecting {{ in entity string.\n",
-                      __FUNCTION__, token);
-    }
-
+  for (const EntityRecord &record : lump->entities) {
     if (!ent)
       ent = g_entities;
     else
@@ -2227,7 +2381,7 @@ void SpawnEntities(const char *mapName, const char *entities,
     if (ent == g_entities)
       InitGEntity(ent);
 
-    entities = ED_ParseEntity(entities, ent);
+    ED_ApplyEntity(record, ent);
     if (ent)
       worr::Logf(worr::LogLevel::Debug, "{}: preparing {} with spawnflags {}",
                  __FUNCTION__, LogEntityLabel(ent),
@@ -2493,6 +2647,7 @@ bool G_ResetWorldEntitiesFromSavedString() {
   level.arenaActive = state.arenaActive;
   level.arenaTotal = state.arenaTotal;
   level.ghosts = state.ghosts;
+  P_RebuildGhostIndex();
   level.autoScreenshotTool_index = state.autoScreenshotTool_index;
   level.autoScreenshotTool_initialised = state.autoScreenshotTool_initialised;
   level.autoScreenshotTool_delayTime = state.autoScreenshotTool_delayTime;
@@ -2533,29 +2688,19 @@ bool G_ResetWorldEntitiesFromSavedString() {
   level.bodyQue = 0;
   InitBodyQue();
 
-  const char *entities = level.savedEntityString.c_str();
+  const auto lump = ED_GetEntityLump(level.mapName.data(), level.savedEntityString);
 
   bool firstEntity = true;
   int inhibited = 0;
 
-  while (true) {
-    const char *token = COM_Parse(&entities);
-    if (!entities)
-      break;
-
-    if (token[0] != '{') {
-      gi.Com_ErrorFmt(
-          "{}: Found \"{}\" when expecting opening brace in entity string.\n",
-          __FUNCTION__, token);
-    }
-
+  for (const EntityRecord &record : lump->entities) {
     gentity_t *ent = firstEntity ? g_entities : Spawn();
     firstEntity = false;
 
     if (ent == g_entities)
       InitGEntity(ent);
 
-    entities = ED_ParseEntity(entities, ent);
+    ED_ApplyEntity(record, ent);
 
     if (ent != g_entities) {
       if (G_InhibitEntity(ent)) {
@@ -1557,6 +1557,7 @@ void ClientSpawn(gentity_t *ent) {
 
   // fix level switch issue
   ent->client->pers.connected = true;
+  G_RosterConnect(ent->client);
 
   // slow time will be unset here
   globals.serverFlags &= ~SERVER_FLAG_SLOW_TIME;
@@ -118,6 +118,88 @@ static gentity_t* AdvanceFollowTarget(const gentity_t* spectator, ptrdiff_t star
 	return nullptr;
 }
 
+/*
+Chase camera placement only depends on the followed player, so it is
+worked out once per target and shared by every spectator following
+them. Followers are updated from the target's ClientThink, possibly
+several times a frame, so a result is reused only for the same frame
+and the same target state it was computed from.
+*/
+struct ChaseCamera {
+	GameTime time = -1_ms;	// level.time this was computed on
+	Vector3 origin{};		// target state it was computed from
+	Vector3 angles{};
+	float viewHeight = 0;
+	bool onGround = false;
+	Vector3 position{};		// resulting camera position
+};
+
+static std::array<ChaseCamera, MAX_CLIENTS> chaseCameras{};
+
+/*
+=============
+ChaseCameraPosition
+
+Returns the third-person chase camera position behind the target,
+reusing the result already computed for it this frame if the target
+has not changed since.
+=============
+*/
+static const Vector3& ChaseCameraPosition(gentity_t* targ) {
+	ChaseCamera& cam = chaseCameras[targ->s.number - 1];
+	const bool onGround = targ->groundEntity != nullptr;
+
+	if (cam.time == level.time && cam.origin == targ->s.origin && cam.angles == targ->client->vAngle &&
+		cam.viewHeight == targ->viewHeight && cam.onGround == onGround)
+		return cam.position;
+
+	cam.time = level.time;
+	cam.origin = targ->s.origin;
+	cam.angles = targ->client->vAngle;
+	cam.viewHeight = targ->viewHeight;
+	cam.onGround = onGround;
+
+	Vector3 angles = targ->client->vAngle;
+	if (angles[PITCH] > 56)
+		angles[PITCH] = 56;
+
+	Vector3 forward;
+	AngleVectors(angles, forward, nullptr, nullptr);
+	forward.normalize();
+
+	Vector3 eyePos = targ->s.origin;
+	eyePos[2] += targ->viewHeight;
+
+	Vector3 cameraPos = eyePos + (forward * -30.0f);
+	if (cameraPos[2] < targ->s.origin[_Z] + 20.0f)
+		cameraPos[2] = targ->s.origin[_Z] + 20.0f;
+	if (!onGround)
+		cameraPos[2] += 16.0f;
+
+	// Main line-of-sight trace
+	trace_t trace = gi.traceLine(eyePos, cameraPos, targ, MASK_SOLID);
+	cameraPos = trace.endPos + (forward * 2.0f);
+
+	// Ceiling pad
+	Vector3 ceilingCheck = cameraPos; ceilingCheck[2] += 6.0f;
+	trace = gi.traceLine(cameraPos, ceilingCheck, targ, MASK_SOLID);
+	if (trace.fraction < 1.0f) {
+		cameraPos = trace.endPos;
+		cameraPos[2] -= 6.0f;
+	}
+
+	// Floor pad
+	Vector3 floorCheck = cameraPos; floorCheck[2] -= 6.0f;
+	trace = gi.traceLine(cameraPos, floorCheck, targ, MASK_SOLID);
+	if (trace.fraction < 1.0f) {
+		cameraPos = trace.endPos;
+		cameraPos[2] += 6.0f;
+	}
+
+	cam.position = cameraPos;
+	return cam.position;
+}
+
 /*
 =============
 ClientUpdateFollowers
@@ -151,10 +233,6 @@ void ClientUpdateFollowers(gentity_t* ent) {
 		return;
 	}
 
-	Vector3 targetOrigin = targ->s.origin;
-	Vector3 cameraPos, forward, right, angles;
-	trace_t trace;
-
 	bool eyecam = g_eyecam->integer != 0;
 
 	if (eyecam) {
@@ -193,50 +271,12 @@ void ClientUpdateFollowers(gentity_t* ent) {
 
 		ent->client->vAngle = targ->client->vAngle;
 		AngleVectors(ent->client->vAngle, ent->client->vForward, nullptr, nullptr);
-
-		// Optional trace (preserve in case used later)
-		trace = gi.traceLine(targ->s.origin, targ->s.origin, targ, MASK_SOLID);
-		cameraPos = trace.endPos;
 	}
 	else {
 		// Vanilla chasecam
 		targ->svFlags &= ~SVF_INSTANCED;
 
-		angles = targ->client->vAngle;
-		if (angles[PITCH] > 56)
-			angles[PITCH] = 56;
-
-		AngleVectors(angles, forward, right, nullptr);
-		forward.normalize();
-
-		Vector3 eyePos = targetOrigin;
-		eyePos[2] += targ->viewHeight;
-
-		cameraPos = eyePos + (forward * -30.0f);
-		if (cameraPos[2] < targ->s.origin[_Z] + 20.0f)
-			cameraPos[2] = targ->s.origin[_Z] + 20.0f;
-		if (!targ->groundEntity)
-			cameraPos[2] += 16.0f;
-
-		// Main line-of-sight trace
-		trace = gi.traceLine(eyePos, cameraPos, targ, MASK_SOLID);
-		cameraPos = trace.endPos + (forward * 2.0f);
-
-		// Ceiling pad
-		Vector3 ceilingCheck = cameraPos; ceilingCheck[2] += 6.0f;
-		trace = gi.traceLine(cameraPos, ceilingCheck, targ, MASK_SOLID);
-		if (trace.fraction < 1.0f) {
-			cameraPos = trace.endPos;
-			cameraPos[2] -= 6.0f;
-		}
-
-		// Floor pad
-		Vector3 floorCheck = cameraPos; floorCheck[2] -= 6.0f;
-		trace = gi.traceLine(cameraPos, floorCheck, targ, MASK_SOLID);
-		if (trace.fraction < 1.0f) {
-			cameraPos = trace.endPos;
-			cameraPos[2] += 6.0f;
-		}
+		const Vector3& cameraPos = ChaseCameraPosition(targ);
 
 		ent->client->ps.gunIndex = 0;
 		ent->client->ps.gunSkin = 0;
@@ -395,6 +395,102 @@ namespace
 		gi.LocBroadcast_Print(PRINT_HIGH, "$g_map_ended_by_server");
 		Match_End();
 	}
+
+	/*
+	==============
+	SVCmd_LinkStats_f
+
+	Lists gi.linkEntity call sites by how many calls were skipped as
+	redundant. Counting is off by default; "sv linkstats on|off" toggles
+	it and "sv linkstats reset" clears the counts.
+	==============
+	*/
+	static void SVCmd_LinkStats_f()
+	{
+		if (gi.argc() > 2) {
+			const char* arg = gi.argv(2);
+			if (!Q_strcasecmp(arg, "reset")) {
+				linkSiteStats.clear();
+				gi.Com_Print("Link stats cleared.\n");
+				return;
+			}
+			if (!Q_strcasecmp(arg, "on") || !Q_strcasecmp(arg, "off")) {
+				linkSiteStatsEnabled = !Q_strcasecmp(arg, "on");
+				gi.Com_PrintFmt("Link stats {}.\n", linkSiteStatsEnabled ? "enabled" : "disabled");
+				return;
+			}
+		}
+
+		if (!linkSiteStatsEnabled)
+			gi.Com_Print("Link stats are not being collected; use \"sv linkstats on\".\n");
+
+		std::vector<std::pair<CallSiteKey, LinkSiteStats>> sites(linkSiteStats.begin(), linkSiteStats.end());
+		std::sort(sites.begin(), sites.end(), [](const auto& a, const auto& b) {
+			return a.second.skipped > b.second.skipped;
+		});
+
+		uint64_t relinked = 0, skipped = 0;
+
+		gi.Com_Print("  skipped  relinked  call site\n");
+		for (const auto& [key, stats] : sites) {
+			gi.Com_PrintFmt("{:9} {:9}  {}:{}\n", stats.skipped, stats.relinked,
+				std::filesystem::path(key.file).filename().string(), key.line);
+			relinked += stats.relinked;
+			skipped += stats.skipped;
+		}
+
+		gi.Com_PrintFmt("{:9} {:9}  total over {} sites\n", skipped, relinked, sites.size());
+	}
+
+	/*
+	==============
+	SVCmd_VisStats_f
+
+	Lists LocCanSee call sites by how many traces they cost, along with
+	the corners the PVS ruled out. Counting is off by default;
+	"sv visstats on|off" toggles it and "sv visstats reset" clears the
+	counts.
+	==============
+	*/
+	static void SVCmd_VisStats_f()
+	{
+		if (gi.argc() > 2) {
+			const char* arg = gi.argv(2);
+			if (!Q_strcasecmp(arg, "reset")) {
+				visSiteStats.clear();
+				gi.Com_Print("Visibility stats cleared.\n");
+				return;
+			}
+			if (!Q_strcasecmp(arg, "on") || !Q_strcasecmp(arg, "off")) {
+				visSiteStatsEnabled = !Q_strcasecmp(arg, "on");
+				gi.Com_PrintFmt("Visibility stats {}.\n", visSiteStatsEnabled ? "enabled" : "disabled");
+				return;
+			}
+		}
+
+		if (!visSiteStatsEnabled)
+			gi.Com_Print("Visibility stats are not being collected; use \"sv visstats on\".\n");
+
+		std::vector<std::pair<CallSiteKey, VisSiteStats>> sites(visSiteStats.begin(), visSiteStats.end());
+		std::sort(sites.begin(), sites.end(), [](const auto& a, const auto& b) {
+			return a.second.traces > b.second.traces;
+		});
+
+		VisSiteStats total{};
+
+		gi.Com_Print("    calls  visible   traces  pvs-skip  call site\n");
+		for (const auto& [key, stats] : sites) {
+			gi.Com_PrintFmt("{:9} {:8} {:8} {:9}  {}:{}\n", stats.calls, stats.visible, stats.traces, stats.pvsSkipped,
+				std::filesystem::path(key.file).filename().string(), key.line);
+			total.calls += stats.calls;
+			total.visible += stats.visible;
+			total.traces += stats.traces;
+			total.pvsSkipped += stats.pvsSkipped;
+		}
+
+		gi.Com_PrintFmt("{:9} {:8} {:8} {:9}  total over {} sites\n", total.calls, total.visible, total.traces,
+			total.pvsSkipped, sites.size());
+	}
 } // anonymous namespace
 
 /*
@@ -515,6 +611,12 @@ void ServerCommand()
 	else if (Q_strcasecmp(cmd, "nextmap") == 0) {
 		SVCmd_NextMap_f();
 	}
+	else if (Q_strcasecmp(cmd, "linkstats") == 0) {
+		SVCmd_LinkStats_f();
+	}
+	else if (Q_strcasecmp(cmd, "visstats") == 0) {
+		SVCmd_VisStats_f();
+	}
 	else {
 		gi.LocClient_Print(nullptr, PRINT_HIGH, "Unknown server command \"{}\"\n", cmd);
 	}
@@ -13,6 +13,23 @@ another entity before they begin operating.*/
 
 #include "../g_local.hpp"
 
+constexpr float TURRET_AIM_TOLERANCE = 0.0087f; // sin(0.5 degrees)
+constexpr float TURRET_SETTLE_EPSILON = 0.01f;
+constexpr GameTime TURRET_DORMANT_THINK = 250_ms;
+constexpr GameTime TURRET_SIGHT_RECHECK = 100_ms;
+
+/*
+=============
+TurretWake
+
+Resumes thinking on a breach that settled and went to sleep.
+=============
+*/
+static void TurretWake(gentity_t* breach) {
+	if (breach->think && !breach->nextThink)
+		breach->nextThink = level.time + FRAME_TIME_S;
+}
+
 /*
 =============
 	TurretRequestFire
@@ -25,6 +42,7 @@ void TurretRequestFire(gentity_t* breach) {
 	return;
 
 	breach->turretFireRequested = true;
+	TurretWake(breach);
 }
 
 /*
@@ -58,6 +76,47 @@ static void AnglesNormalize(Vector3& vec) {
 	vec[1] += 360;
 }
 
+/*
+=============
+TurretClientNearby
+
+True if any client could be seen or heard from the breach. Turrets
+without an enemy stay dormant until this passes.
+=============
+*/
+static bool TurretClientNearby(const gentity_t* breach) {
+	for (auto player : active_clients())
+		if (gi.inPHS(breach->s.origin, player->s.origin, true))
+			return true;
+
+	return false;
+}
+
+/*
+=============
+TurretAim
+
+Points the breach at a world position. The solution is reused until the
+target drifts past TURRET_AIM_TOLERANCE as seen from the breach, so a
+still or slow target costs no angle math and lets the breach sleep.
+=============
+*/
+static void TurretAim(gentity_t* breach, const Vector3& target) {
+	const Vector3 dir = target - breach->s.origin;
+
+	if (breach->turret.aimValid) {
+		const float drift = (target - breach->turret.aimPoint).lengthSquared();
+
+		if (drift <= dir.lengthSquared() * (TURRET_AIM_TOLERANCE * TURRET_AIM_TOLERANCE))
+			return;
+	}
+
+	breach->turret.aimPoint = target;
+	breach->turret.aimValid = true;
+	breach->moveAngles = VectorToAngles(dir);
+	TurretWake(breach);
+}
+
 /*
 =============
 turret_blocked
@@ -180,6 +239,22 @@ static THINK(turret_breach_think) (gentity_t* self) -> void {
 	if (delta[1] < -1 * self->speed * gi.frameTimeSec)
 		delta[1] = -1 * self->speed * gi.frameTimeSec;
 
+	// on target with nothing to fire; snap and sleep until re-aimed
+	const bool settled = std::fabs(delta[0]) < TURRET_SETTLE_EPSILON &&
+		std::fabs(delta[1]) < TURRET_SETTLE_EPSILON && !self->turretFireRequested;
+
+	if (settled) {
+		// take up the leftover fraction of a degree so we rest exactly on target
+		for (ent = self->teamMaster; ent; ent = ent->teamChain) {
+			if (ent == self)
+				ent->s.angles[PITCH] += delta[PITCH];
+			ent->s.angles[YAW] += delta[YAW];
+			gi.linkEntity(ent);
+		}
+
+		delta = {};
+	}
+
 	for (ent = self->teamMaster; ent; ent = ent->teamChain) {
 		if (ent->noiseIndex) {
 			if (delta[0] || delta[1]) {
@@ -231,6 +306,13 @@ static THINK(turret_breach_think) (gentity_t* self) -> void {
 		if (TurretConsumeFireRequest(self))
 		turret_breach_fire(self);
 }
+
+	if (settled) {
+		self->nextThink = 0_ms;
+
+		if (self->owner)
+			self->owner->velocity = {};
+	}
 }
 
 /*
@@ -347,6 +429,9 @@ static DIE(turret_driver_die) (gentity_t* self, gentity_t* inflictor, gentity_t*
 
 		// level the gun
 		self->targetEnt->moveAngles[PITCH] = 0;
+		self->targetEnt->turret.aimValid = false;
+		self->targetEnt->turretFireRequested = false;
+		TurretWake(self->targetEnt);
 
 		// remove the driver from the end of them team chain
 		for (ent = self->targetEnt->teamMaster; ent->teamChain != self; ent = ent->teamChain)
@@ -384,7 +469,6 @@ turret_driver_think
 */
 static THINK(turret_driver_think) (gentity_t* self) -> void {
 	Vector3 target;
-	Vector3 dir;
 
 	self->nextThink = level.time + FRAME_TIME_S;
 
@@ -392,6 +476,12 @@ static THINK(turret_driver_think) (gentity_t* self) -> void {
 		self->enemy = nullptr;
 
 	if (!self->enemy) {
+		// nobody to see or hear; check back later
+		if (!TurretClientNearby(self->targetEnt)) {
+			self->nextThink = level.time + TURRET_DORMANT_THINK;
+			return;
+		}
+
 		if (!FindTarget(self))
 			return;
 		self->monsterInfo.trailTime = level.time;
@@ -417,8 +507,7 @@ static THINK(turret_driver_think) (gentity_t* self) -> void {
 
 	target = self->enemy->s.origin;
 	target[2] += self->enemy->viewHeight;
-	dir = target - self->targetEnt->s.origin;
-	self->targetEnt->moveAngles = VectorToAngles(dir);
+	TurretAim(self->targetEnt, target);
 
 	// decide if we should shoot
 	if (level.time < self->monsterInfo.attackFinished)
@@ -538,8 +627,6 @@ turret_brain_think
 =============
 */
 static THINK(turret_brain_think) (gentity_t* self) -> void {
-	Vector3	target;
-	Vector3	dir;
 	Vector3	endPos;
 	trace_t trace;
 
@@ -553,10 +640,16 @@ static THINK(turret_brain_think) (gentity_t* self) -> void {
 	}
 
 	if (!self->enemy) {
+		if (!TurretClientNearby(self->targetEnt)) {
+			self->nextThink = level.time + TURRET_DORMANT_THINK;
+			return;
+		}
+
 		if (!FindTarget(self))
 			return;
 		self->monsterInfo.trailTime = level.time;
 		self->monsterInfo.aiFlags &= ~AI_LOST_SIGHT;
+		self->turret.sightTime = 0_ms;
 	}
 
 	if (self->enemy) {
@@ -565,8 +658,19 @@ static THINK(turret_brain_think) (gentity_t* self) -> void {
 	}
 
 	if (!self->spawnFlags.has(SPAWNFLAG_TURRET_BRAIN_IGNORE_SIGHT)) {
-		trace = gi.traceLine(self->targetEnt->s.origin, endPos, self->targetEnt, MASK_SHOT);
-		if (trace.fraction == 1 || trace.ent == self->enemy) {
+		// re-trace only when the aim point drifts or the result gets old
+		const Vector3 dir = endPos - self->targetEnt->s.origin;
+		const float drift = (endPos - self->turret.sightPoint).lengthSquared();
+
+		if (level.time >= self->turret.sightTime ||
+			drift > dir.lengthSquared() * (TURRET_AIM_TOLERANCE * TURRET_AIM_TOLERANCE)) {
+			trace = gi.traceLine(self->targetEnt->s.origin, endPos, self->targetEnt, MASK_SHOT);
+			self->turret.sightPoint = endPos;
+			self->turret.sightTime = level.time + TURRET_SIGHT_RECHECK;
+			self->turret.sightClear = trace.fraction == 1 || trace.ent == self->enemy;
+		}
+
+		if (self->turret.sightClear) {
 			if (self->monsterInfo.aiFlags & AI_LOST_SIGHT) {
 				self->monsterInfo.trailTime = level.time;
 				self->monsterInfo.aiFlags &= ~AI_LOST_SIGHT;
@@ -579,9 +683,7 @@ static THINK(turret_brain_think) (gentity_t* self) -> void {
 	}
 
 	// let the turret know where we want it to aim
-	target = endPos;
-	dir = target - self->targetEnt->s.origin;
-	self->targetEnt->moveAngles = VectorToAngles(dir);
+	TurretAim(self->targetEnt, endPos);
 
 	// decide if we should shoot
 	if (level.time < self->monsterInfo.attackFinished)
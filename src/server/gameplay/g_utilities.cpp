@@ -17,6 +17,7 @@ within a volume and `TouchTriggers` for activating triggers.*/
 #include "../../shared/weapon_pref_utils.hpp"
 #include "../g_local.hpp"
 #include "team_balance.hpp"
+#include <algorithm>
 #include <array>
 #include <cctype>
 #include <chrono> // get real time
@@ -795,7 +796,9 @@ void AssignPlayerSkin(gentity_t *ent, const std::string &skin) {
     finalSkin = G_Fmt("{}\\{}\\default", ent->client->sess.netName, cleanSkin);
   }
 
-  gi.configString(CS_PLAYERSKINS + playernum, finalSkin.c_str());
+  const char *current = gi.get_configString(CS_PLAYERSKINS + playernum);
+  if (std::string_view(current ? current : "") != finalSkin)
+    gi.configString(CS_PLAYERSKINS + playernum, finalSkin.c_str());
 }
 
 /*
@@ -986,15 +989,28 @@ static void LocBuildBoxPoints(Vector3 (&p)[8], const Vector3 &org,
 /*
 =================
 LocCanSee
+
+The target is visible when a clear line reaches any corner of its box.
+Corners are tried from the one nearest the viewer outwards, so visible
+targets usually stop after the first trace; coincident corners (point
+entities, flat boxes) are only traced once and corners outside the
+viewer's PVS are never traced.
 =================
 */
-bool LocCanSee(gentity_t *targetEnt, gentity_t *sourceEnt) {
+bool LocCanSee(gentity_t *targetEnt, gentity_t *sourceEnt,
+               const std::source_location &where) {
   if (!targetEnt || !sourceEnt)
     return false;
 
   if (targetEnt->moveType == MoveType::Push)
     return false; // bmodels not supported
 
+  VisSiteStats *stats = visSiteStatsEnabled
+                            ? &visSiteStats[{where.file_name(), where.line()}]
+                            : nullptr;
+  if (stats)
+    stats->calls++;
+
   Vector3 targpoints[8];
   LocBuildBoxPoints(targpoints, targetEnt->s.origin, targetEnt->mins,
                     targetEnt->maxs);
@@ -1002,11 +1018,44 @@ bool LocCanSee(gentity_t *targetEnt, gentity_t *sourceEnt) {
   Vector3 viewpoint = sourceEnt->s.origin;
   viewpoint[2] += sourceEnt->viewHeight;
 
+  const Vector3 center =
+      targetEnt->s.origin + (targetEnt->mins + targetEnt->maxs) * 0.5f;
+  const Vector3 toViewer = viewpoint - center;
+
+  std::array<float, 8> facing;
+  std::array<int, 8> order;
   for (int i = 0; i < 8; i++) {
-    trace_t trace = gi.traceLine(viewpoint, targpoints[i], sourceEnt,
+    facing[i] = (targpoints[i] - center).dot(toViewer);
+    order[i] = i;
+  }
+  std::sort(order.begin(), order.end(),
+            [&facing](int a, int b) { return facing[a] > facing[b]; });
+
+  for (int n = 0; n < 8; n++) {
+    const Vector3 &point = targpoints[order[n]];
+
+    bool duplicate = false;
+    for (int m = 0; m < n && !duplicate; m++)
+      duplicate = targpoints[order[m]] == point;
+    if (duplicate)
+      continue;
+
+    // a clear line implies a shared PVS; skip the trace when there isn't one
+    if (!gi.inPVS(viewpoint, point, false)) {
+      if (stats)
+        stats->pvsSkipped++;
+      continue;
+    }
+
+    if (stats)
+      stats->traces++;
+    trace_t trace = gi.traceLine(viewpoint, point, sourceEnt,
                                  CONTENTS_MIST | MASK_WATER | MASK_SOLID);
-    if (trace.fraction == 1.0f)
+    if (trace.fraction == 1.0f) {
+      if (stats)
+        stats->visible++;
       return true; // Early exit if any point is visible
+    }
   }
 
   return false;
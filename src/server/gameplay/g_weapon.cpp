@@ -1072,7 +1072,8 @@ void fire_rail(gentity_t *self, const Vector3 &start, const Vector3 &aimDir,
     Vector3 org = player->s.origin + player->client->ps.viewOffset +
                   Vector3{0, 0, (float)player->client->ps.pmove.viewHeight};
 
-    if (binary_positional_search(org, start, args.tr.endPos, gi.inPHS, 3)) {
+    if (binary_positional_search(org, start, args.tr.endPos,
+                                 gi.game_import_t::inPHS, 3)) {
       gi.WriteByte(svc_temp_entity);
       gi.WriteByte((deathmatch->integer && g_instaGib->integer) ? TE_RAILTRAIL2
                                                                 : TE_RAILTRAIL);
@@ -2745,10 +2746,7 @@ static THINK(Nuke_Think)(gentity_t *ent)->void {
     // fired at point blank wall
     ent->owner = nullptr;
 
-    gi.WriteByte(svc_muzzleflash);
-    gi.WriteEntity(ent);
-    gi.WriteByte(muzzleflash);
-    gi.multicast(ent->s.origin, MULTICAST_PHS, false);
+    G_MuzzleFlash(ent, ent->s.origin, muzzleflash, MULTICAST_PHS);
 
     if (ent->timeStamp <= level.time) {
       if ((GameTime::from_sec(ent->wait) - level.time) <=
@@ -4124,3 +4122,146 @@ int G_ExplodeNearbyMinesSafe(const Vector3 &origin, float radius,
 
   return detonated;
 }
+
+/*
+=============
+Muzzle flash queue
+
+Weapon and monster fire can emit several flashes per entity in a single
+server frame (horde waves of machinegunners especially). The client keys
+its flash light and weapon sound on the entity, so a flash that repeats
+the entity's previous one before that has faded is invisible, and the new
+sound just cuts off the old one on the same channel. Flashes are collected
+during the frame; an (entity, id) pair repeated inside
+MUZZLE_FLASH_REPEAT_INTERVAL is dropped, and everything else is sent in
+one pass at frame end. Distinct ids are always kept: multi-barrel volleys
+(carrier and boss2 rockets) use one id per barrel.
+=============
+*/
+namespace {
+constexpr size_t MUZZLE_FLASH_QUEUE_SIZE = 256;
+// repeats faster than this can't be told apart on the client; weapons
+// firing at the classic 10 or 20 Hz rates are never culled
+constexpr GameTime MUZZLE_FLASH_REPEAT_INTERVAL = 50_ms;
+
+struct QueuedMuzzleFlash {
+  gentity_t *ent;
+  Vector3 origin;
+  uint16_t id;
+  bool monster;
+  multicast_t to;
+};
+
+std::array<QueuedMuzzleFlash, MUZZLE_FLASH_QUEUE_SIZE> flashQueue;
+size_t flashQueueCount = 0;
+
+/*
+=============
+G_WriteMuzzleFlash
+=============
+*/
+void G_WriteMuzzleFlash(const QueuedMuzzleFlash &flash) {
+  if (flash.monster) {
+    gi.WriteByte(flash.id <= 255 ? svc_muzzleflash2 : svc_muzzleflash3);
+    gi.WriteEntity(flash.ent);
+
+    if (flash.id <= 255)
+      gi.WriteByte(flash.id);
+    else
+      gi.WriteShort(flash.id);
+  } else {
+    gi.WriteByte(svc_muzzleflash);
+    gi.WriteEntity(flash.ent);
+    gi.WriteByte(flash.id);
+  }
+
+  gi.multicast(flash.origin, flash.to, false);
+}
+
+/*
+=============
+G_QueueMuzzleFlash
+
+Adds a flash to this frame's queue. An identical flash already queued
+for the entity just takes the newer origin; one that repeats the entity's
+last sent flash within MUZZLE_FLASH_REPEAT_INTERVAL is dropped.
+=============
+*/
+void G_QueueMuzzleFlash(gentity_t *ent, const Vector3 &origin, uint16_t id,
+                        bool monster, multicast_t to) {
+  for (size_t i = 0; i < flashQueueCount; i++) {
+    QueuedMuzzleFlash &queued = flashQueue[i];
+
+    if (queued.ent == ent && queued.id == id && queued.monster == monster) {
+      queued.origin = origin;
+      return;
+    }
+  }
+
+  auto &last = ent->lastMuzzleFlash;
+  if (last.valid && last.id == id && last.monster == monster &&
+      level.time - last.time < MUZZLE_FLASH_REPEAT_INTERVAL)
+    return;
+
+  last.time = level.time;
+  last.id = id;
+  last.monster = monster;
+  last.valid = true;
+
+  const QueuedMuzzleFlash flash{ent, origin, id, monster, to};
+
+  // queue is full; don't lose the flash, just send it now
+  if (flashQueueCount == flashQueue.size()) {
+    G_WriteMuzzleFlash(flash);
+    return;
+  }
+
+  flashQueue[flashQueueCount++] = flash;
+}
+} // namespace
+
+/*
+=============
+G_MuzzleFlash
+
+Queues a player-style (MZ_*) muzzle flash for the entity.
+=============
+*/
+void G_MuzzleFlash(gentity_t *ent, const Vector3 &origin, uint8_t flash,
+                   multicast_t to) {
+  G_QueueMuzzleFlash(ent, origin, flash, false, to);
+}
+
+/*
+=============
+G_MonsterMuzzleFlash
+
+Queues a monster (MZ2_*) muzzle flash for the entity.
+=============
+*/
+void G_MonsterMuzzleFlash(gentity_t *ent, const Vector3 &origin,
+                          MonsterMuzzleFlashID id) {
+  G_QueueMuzzleFlash(ent, origin, static_cast<uint16_t>(id), true,
+                     MULTICAST_PHS);
+}
+
+/*
+=============
+G_FlushMuzzleFlashes
+
+Sends every flash queued this frame. Flashes whose entity was freed
+before the end of the frame are discarded.
+=============
+*/
+void G_FlushMuzzleFlashes() {
+  for (size_t i = 0; i < flashQueueCount; i++) {
+    const QueuedMuzzleFlash &flash = flashQueue[i];
+
+    if (!flash.ent->inUse)
+      continue;
+
+    G_WriteMuzzleFlash(flash);
+  }
+
+  flashQueueCount = 0;
+}
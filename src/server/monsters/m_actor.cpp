@@ -75,10 +75,7 @@ static void CheckSeenKiller(gentity_t* victim, gentity_t* killer)
 // Use original MZ_ muzzleflash instead of MZ2_
 static void actorMuzzleflash(gentity_t* self, const Vector3& start, int flashType)
 {
-	gi.WriteByte(svc_muzzleflash);
-	gi.WriteShort(self - g_entities);
-	gi.WriteByte(static_cast<byte>(flashType));
-	gi.multicast(start, MULTICAST_PVS, false);
+	G_MuzzleFlash(self, start, static_cast<uint8_t>(flashType), MULTICAST_PVS);
 }
 
 static void actorBlaster(gentity_t* self, const Vector3& start, const Vector3& forward, bool hyper)
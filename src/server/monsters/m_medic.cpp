@@ -262,8 +262,8 @@ static bool canReach(gentity_t *self, gentity_t *other) {
 
 static gentity_t *medic_FindDeadMonster(gentity_t *self) {
 	float	 radius;
-	gentity_t *ent = nullptr;
 	gentity_t *best = nullptr;
+	static gentity_t *candidates[MAX_ENTITIES];
 
 	if (self->monsterInfo.react_to_damage_time > level.time)
 		return nullptr;
@@ -273,7 +273,11 @@ static gentity_t *medic_FindDeadMonster(gentity_t *self) {
 	else
 		radius = 1024;
 
-	while ((ent = FindRadius(ent, self->s.origin, radius)) != nullptr) {
+	const size_t numCandidates = M_CorpsesInRadius(self->s.origin, radius, candidates, MAX_ENTITIES);
+
+	for (size_t i = 0; i < numCandidates; i++) {
+		gentity_t *ent = candidates[i];
+
 		if (ent == self)
 			continue;
 		if (!(ent->svFlags & SVF_MONSTER))
@@ -294,7 +298,7 @@ static gentity_t *medic_FindDeadMonster(gentity_t *self) {
 			continue;
 		if ((ent->nextThink) && (ent->think != monster_dead_think))
 			continue;
-		if (!visible(self, ent))
+		if (!M_CorpseVisible(self, ent))
 			continue;
 		if (!strncmp(ent->className, "player", 6)) // stop it from trying to heal player_noise entities
 			continue;
@@ -5,6 +5,9 @@ m_move.c -- monster movement*/
 
 #include "../g_local.hpp"
 
+#include <cmath>
+#include <unordered_map>
+
 // this is used for communications out of g_movestep to say what entity
 // is blocking us
 gentity_t *new_bad; // pmm
@@ -43,7 +46,128 @@ bool M_CheckBottom_Fast_Generic(const Vector3 &absmins, const Vector3 &absmaxs,
 	return true; // we got out easy
 }
 
+/*
+=============
+SUPPORT CACHE
+
+The slow bottom check only ever sees world geometry when no solid entity is
+under the monster, and the world never changes during a level. Those results
+are kept per hull, mask and gravity on a fine grid and reused; anywhere a
+mover, monster or other solid entity is in the probe volume the real traces
+run and nothing is stored. Cleared by SpawnEntities.
+=============
+*/
+namespace {
+constexpr float SUPPORT_CELL_SIZE = 2.f;   // across the floor
+constexpr float SUPPORT_CELL_HEIGHT = 1.f; // along gravity
+constexpr size_t MAX_SUPPORT_CELLS = 1u << 16;
+
+struct SupportKey {
+	std::array<int32_t, 3> cell;
+	Vector3 mins, maxs;
+	contents_t mask;
+	int8_t gravityAxis;
+	bool allowAnyStep;
+
+	bool operator==(const SupportKey &) const = default;
+};
+
+struct SupportKeyHash {
+	size_t operator()(const SupportKey &key) const noexcept {
+		size_t hash = 0;
+		auto mix = [&hash](size_t value) {
+			hash ^= value + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+		};
+		for (int32_t c : key.cell)
+			mix(std::hash<int32_t>{}(c));
+		for (int i = 0; i < 3; i++) {
+			mix(std::hash<float>{}(key.mins[i]));
+			mix(std::hash<float>{}(key.maxs[i]));
+		}
+		mix(static_cast<size_t>(key.mask));
+		mix(static_cast<size_t>(key.gravityAxis) << 1 | key.allowAnyStep);
+		return hash;
+	}
+};
+
+std::unordered_map<SupportKey, bool, SupportKeyHash> supportCache;
+
+/*
+=============
+M_SupportProbeBlocker
+
+Any solid entity other than the checker makes the region dynamic.
+=============
+*/
+BoxEntitiesResult_t M_SupportProbeBlocker(gentity_t *other, void *data) {
+	if (other == static_cast<gentity_t *>(data))
+		return BoxEntitiesResult_t::Skip;
+
+	return BoxEntitiesResult_t::Keep | BoxEntitiesResult_t::End;
+}
+} // namespace
+
+/*
+=============
+M_ClearSupportCache
+=============
+*/
+void M_ClearSupportCache() {
+	supportCache.clear();
+}
+
+static bool M_CheckBottom_Traced(const Vector3 &origin, const Vector3 &mins, const Vector3 &maxs, gentity_t *ignore, contents_t mask, const Vector3 &gravityDir, bool allow_any_step_height);
+
 bool M_CheckBottom_Slow_Generic(const Vector3 &origin, const Vector3 &mins, const Vector3 &maxs, gentity_t *ignore, contents_t mask, const Vector3 &gravityDir, bool allow_any_step_height) {
+	int majorAxis = 0;
+	if (fabsf(gravityDir[1]) > fabsf(gravityDir[0])) majorAxis = 1;
+	if (fabsf(gravityDir[2]) > fabsf(gravityDir[majorAxis])) majorAxis = 2;
+
+	// probe volume: the hull footprint swept STEPSIZE * 2 along gravity
+	Vector3 absmin = origin + mins;
+	Vector3 absmax = origin + maxs;
+	if (gravityDir[majorAxis] > 0) {
+		absmin[majorAxis] = absmax[majorAxis];
+		absmax[majorAxis] += STEPSIZE * 2;
+	} else {
+		absmax[majorAxis] = absmin[majorAxis];
+		absmin[majorAxis] -= STEPSIZE * 2;
+	}
+
+	if (gi.BoxEntities(absmin, absmax, nullptr, 0, AREA_SOLID, M_SupportProbeBlocker, ignore))
+		return M_CheckBottom_Traced(origin, mins, maxs, ignore, mask, gravityDir, allow_any_step_height);
+
+	SupportKey key{};
+	for (int i = 0; i < 3; i++) {
+		const float size = (i == majorAxis) ? SUPPORT_CELL_HEIGHT : SUPPORT_CELL_SIZE;
+		key.cell[i] = static_cast<int32_t>(std::floor(origin[i] / size));
+	}
+	key.mins = mins;
+	key.maxs = maxs;
+	key.mask = mask;
+	key.gravityAxis = static_cast<int8_t>(gravityDir[majorAxis] > 0 ? majorAxis + 1 : -(majorAxis + 1));
+	key.allowAnyStep = allow_any_step_height;
+
+	if (auto it = supportCache.find(key); it != supportCache.end())
+		return it->second;
+
+	const bool supported = M_CheckBottom_Traced(origin, mins, maxs, ignore, mask, gravityDir, allow_any_step_height);
+
+	if (supportCache.size() >= MAX_SUPPORT_CELLS)
+		supportCache.clear();
+	supportCache.emplace(key, supported);
+
+	return supported;
+}
+
+/*
+=============
+M_CheckBottom_Traced
+
+The real world-and-entity bottom check behind the support cache.
+=============
+*/
+static bool M_CheckBottom_Traced(const Vector3 &origin, const Vector3 &mins, const Vector3 &maxs, gentity_t *ignore, contents_t mask, const Vector3 &gravityDir, bool allow_any_step_height) {
 	Vector3 start, stop;
 	int majorAxis = 0;
 	if (fabsf(gravityDir[1]) > fabsf(gravityDir[0])) majorAxis = 1;
@@ -197,13 +321,83 @@ static inline bool G_flystep_testvisposition(Vector3 start, Vector3 end, Vector3
 	return false;
 }
 
+// the enemy has to move this far before a clear hover fit is traced again
+constexpr float FLY_FIT_REFRESH_DISTANCE = 16.f;
+// how long a pinned flyer trusts that it can still see its enemy
+constexpr GameTime FLY_PINNED_VISIBLE_TIME = 200_ms;
+
+/*
+=============
+G_FlyPinnedEnemyVisible
+
+Pinned flyers check every frame whether their enemy is still in view; a
+positive answer is reused briefly since losing sight only makes them pick
+a new hover position a frame or two later. The answer belongs to the enemy
+it was made for, so switching targets always checks again.
+=============
+*/
+static bool G_FlyPinnedEnemyVisible(gentity_t *ent) {
+	auto &mi = ent->monsterInfo;
+
+	if (mi.fly_pinned_visible_time > level.time &&
+		mi.fly_pinned_visible_enemy == ent->enemy &&
+		mi.fly_pinned_visible_spawn_count == ent->enemy->spawn_count)
+		return true;
+
+	if (!visible(ent, ent->enemy))
+		return false;
+
+	mi.fly_pinned_visible_time = level.time + FLY_PINNED_VISIBLE_TIME;
+	mi.fly_pinned_visible_enemy = ent->enemy;
+	mi.fly_pinned_visible_spawn_count = ent->enemy->spawn_count;
+	return true;
+}
+
+/*
+=============
+G_FlyFitWantedPosition
+
+Pulls the wanted hover position back to where a small box fits when
+coming out from `from`. Flyers circling a target ask this every frame for
+nearly the same line, so a clear fit is reused while neither end has moved
+more than FLY_FIT_REFRESH_DISTANCE. To make that safe the clearance is
+proven with a box grown by FLY_FIT_REFRESH_DISTANCE, which holds every
+line whose ends stay within that radius; the small box is only traced
+when the grown one is blocked.
+=============
+*/
+static Vector3 G_FlyFitWantedPosition(gentity_t *ent, const Vector3 &from, const Vector3 &wanted) {
+	auto &mi = ent->monsterInfo;
+
+	if (mi.fly_fit_clear &&
+		(from - mi.fly_fit_from).lengthSquared() <= FLY_FIT_REFRESH_DISTANCE * FLY_FIT_REFRESH_DISTANCE &&
+		(wanted - mi.fly_fit_to).lengthSquared() <= FLY_FIT_REFRESH_DISTANCE * FLY_FIT_REFRESH_DISTANCE)
+		return wanted;
+
+	constexpr float FIT_SIZE = 8.f;
+	constexpr float PROBE_SIZE = FIT_SIZE + FLY_FIT_REFRESH_DISTANCE;
+
+	mi.fly_fit_from = from;
+	mi.fly_fit_to = wanted;
+
+	trace_t tr = gi.trace(from, { -PROBE_SIZE, -PROBE_SIZE, -PROBE_SIZE }, { PROBE_SIZE, PROBE_SIZE, PROBE_SIZE }, wanted, ent, MASK_SOLID | CONTENTS_MONSTERCLIP);
+	mi.fly_fit_clear = tr.fraction == 1.0f && !tr.startSolid;
+
+	if (mi.fly_fit_clear)
+		return wanted;
+
+	tr = gi.trace(from, { -FIT_SIZE, -FIT_SIZE, -FIT_SIZE }, { FIT_SIZE, FIT_SIZE, FIT_SIZE }, wanted, ent, MASK_SOLID | CONTENTS_MONSTERCLIP);
+
+	return tr.allSolid ? wanted : tr.endPos;
+}
+
 static bool G_alternate_flystep(gentity_t *ent, Vector3 move, bool relink, gentity_t *current_bad) {
 	// swimming monsters just follow their velocity in the air
 	if ((ent->flags & FL_SWIM) && ent->waterLevel < WATER_UNDER)
 		return true;
 
 	if (ent->monsterInfo.fly_position_time <= level.time ||
-		(ent->enemy && ent->monsterInfo.fly_pinned && !visible(ent, ent->enemy))) {
+		(ent->enemy && ent->monsterInfo.fly_pinned && !G_FlyPinnedEnemyVisible(ent))) {
 		ent->monsterInfo.fly_pinned = false;
 		ent->monsterInfo.fly_position_time = level.time + random_time(3_sec, 10_sec);
 		ent->monsterInfo.fly_ideal_position = G_IdealHoverPosition(ent);
@@ -255,10 +449,7 @@ static bool G_alternate_flystep(gentity_t *ent, Vector3 move, bool relink, genti
 		wanted_pos = (towards_origin + (towards_velocity * 0.25f)) + ent->monsterInfo.fly_ideal_position;
 
 	// find a place we can fit in from here
-	trace_t tr = gi.trace(towards_origin, { -8.f, -8.f, -8.f }, { 8.f, 8.f, 8.f }, wanted_pos, ent, MASK_SOLID | CONTENTS_MONSTERCLIP);
-
-	if (!tr.allSolid)
-		wanted_pos = tr.endPos;
+	wanted_pos = G_FlyFitWantedPosition(ent, towards_origin, wanted_pos);
 
 	float dist_to_wanted;
 	Vector3 dest_diff = (wanted_pos - ent->s.origin);
@@ -272,7 +463,7 @@ static bool G_alternate_flystep(gentity_t *ent, Vector3 move, bool relink, genti
 		ent->ideal_yaw = vectoyaw((towards_origin - ent->s.origin).normalized());
 
 	// check if we're blocked from moving this way from where we are
-	tr = gi.trace(ent->s.origin, ent->mins, ent->maxs, ent->s.origin + (wanted_dir * ent->monsterInfo.fly_acceleration), ent, MASK_SOLID | CONTENTS_MONSTERCLIP);
+	trace_t tr = gi.trace(ent->s.origin, ent->mins, ent->maxs, ent->s.origin + (wanted_dir * ent->monsterInfo.fly_acceleration), ent, MASK_SOLID | CONTENTS_MONSTERCLIP);
 
 	Vector3 aim_fwd, aim_rgt, aim_up;
 	Vector3 yaw_angles = { 0, ent->s.angles.y, 0 };
@@ -36,6 +36,7 @@ which holds all of a player's game-related state.*/
 #include <memory>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace worr::server::client {
@@ -386,6 +387,35 @@ void worr::server::client::P_AccumulateMatchPlayTime(gclient_t *cl,
   cl->sess.playStartRealTime = now;
 }
 
+/*
+===============
+P_GhostKey
+
+Ghost slots match social IDs case-insensitively; the index is keyed on the
+lowercased ID.
+===============
+*/
+static std::string P_GhostKey(std::string_view socialID) {
+  std::string key(socialID);
+  for (char &c : key)
+    c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+  return key;
+}
+
+/*
+===============
+P_RebuildGhostIndex
+
+Recomputes level.ghostIndex after level.ghosts is replaced wholesale.
+===============
+*/
+void P_RebuildGhostIndex() {
+  level.ghostIndex.clear();
+  for (size_t i = 0; i < level.ghosts.size(); i++)
+    if (level.ghosts[i].socialID[0])
+      level.ghostIndex.try_emplace(P_GhostKey(level.ghosts[i].socialID), i);
+}
+
 /*
 ===============
 P_SaveGhostSlot
@@ -423,14 +453,18 @@ void P_SaveGhostSlot(gentity_t *ent) {
     return;
 
   // Find existing ghost slot or first free one
+  std::string key = P_GhostKey(socialID);
   Ghosts *slot = nullptr;
-  for (auto &g : level.ghosts) {
-    if (Q_strcasecmp(g.socialID, socialID) == 0) {
-      slot = &g;
-      break;
+  if (auto it = level.ghostIndex.find(key); it != level.ghostIndex.end()) {
+    slot = &level.ghosts[it->second];
+  } else {
+    for (size_t i = 0; i < level.ghosts.size(); i++) {
+      if (!*level.ghosts[i].socialID) {
+        slot = &level.ghosts[i];
+        level.ghostIndex.emplace(std::move(key), i);
+        break;
+      }
     }
-    if (!*g.socialID && !slot)
-      slot = &g;
   }
 
   if (!slot)
@@ -469,11 +503,9 @@ void P_RestoreFromGhostSlot(gentity_t *ent) {
   if (!cl->sess.socialID || !*cl->sess.socialID)
     return;
 
-  const char *socialID = cl->sess.socialID;
-
-  for (auto &g : level.ghosts) {
-    if (Q_strcasecmp(g.socialID, socialID) != 0)
-      continue;
+  auto it = level.ghostIndex.find(P_GhostKey(cl->sess.socialID));
+  if (it != level.ghostIndex.end()) {
+    Ghosts &g = level.ghosts[it->second];
 
     // Restore inventory and stats
     cl->pers.inventory = g.inventory;
@@ -496,7 +528,7 @@ void P_RestoreFromGhostSlot(gentity_t *ent) {
 
     // Clear the ghost slot
     g = Ghosts{};
-    return;
+    level.ghostIndex.erase(it);
   }
 }
 
@@ -1892,6 +1924,110 @@ static void FreezeTag_StartFrozenState(gentity_t *ent) {
   }
 }
 
+/*
+=============
+FreezeTag proximity grid
+
+Playing clients bucketed by a coarse 3D cell once per server frame, so thaw
+lookups only look at players in the neighbouring cells instead of the
+whole server. Each cell is wider than any thaw range, so the 3x3x3 block
+around a point always covers the range; candidates are still checked by
+distance and the usual thaw rules.
+=============
+*/
+namespace {
+constexpr float FREEZETAG_GRID_CELL = 128.0f;
+constexpr size_t FREEZETAG_GRID_BUCKETS = 128;
+
+struct FreezeTagProximityGrid {
+  uint32_t serverFrame = 0;
+  GameTime time = -1_ms;
+  std::array<int16_t, FREEZETAG_GRID_BUCKETS> head{};
+  std::array<int16_t, MAX_CLIENTS> next{};
+  std::array<gentity_t *, MAX_CLIENTS> ents{};
+};
+
+FreezeTagProximityGrid freezeTagGrid;
+
+/*
+=============
+FreezeTag_GridBucket
+=============
+*/
+size_t FreezeTag_GridBucket(int x, int y, int z) {
+  const uint32_t hash = static_cast<uint32_t>(x) * 73856093u ^
+                        static_cast<uint32_t>(y) * 19349663u ^
+                        static_cast<uint32_t>(z) * 83492791u;
+  return hash & (FREEZETAG_GRID_BUCKETS - 1);
+}
+
+/*
+=============
+FreezeTag_GridCell
+=============
+*/
+int FreezeTag_GridCell(float v) {
+  return static_cast<int>(std::floor(v / FREEZETAG_GRID_CELL));
+}
+
+/*
+=============
+FreezeTag_RefreshGrid
+
+Rebuilds the grid when the server frame or level time has moved on.
+=============
+*/
+void FreezeTag_RefreshGrid() {
+  auto &grid = freezeTagGrid;
+  const uint32_t frame = gi.ServerFrame();
+
+  if (grid.serverFrame == frame && grid.time == level.time)
+    return;
+
+  grid.serverFrame = frame;
+  grid.time = level.time;
+  grid.head.fill(-1);
+
+  int16_t count = 0;
+  for (gentity_t *ent : active_clients()) {
+    if (!ClientIsPlaying(ent->client) || count >= static_cast<int16_t>(grid.ents.size()))
+      continue;
+
+    const size_t bucket = FreezeTag_GridBucket(FreezeTag_GridCell(ent->s.origin[0]),
+                                               FreezeTag_GridCell(ent->s.origin[1]),
+                                               FreezeTag_GridCell(ent->s.origin[2]));
+    grid.ents[count] = ent;
+    grid.next[count] = grid.head[bucket];
+    grid.head[bucket] = count;
+    count++;
+  }
+}
+
+/*
+=============
+FreezeTag_ForEachNearby
+
+Calls fn for every playing client whose cell neighbours the one holding
+origin. Hash collisions can hand out a client more than once.
+=============
+*/
+template <typename Fn>
+void FreezeTag_ForEachNearby(const Vector3 &origin, Fn &&fn) {
+  FreezeTag_RefreshGrid();
+
+  const int cx = FreezeTag_GridCell(origin[0]);
+  const int cy = FreezeTag_GridCell(origin[1]);
+  const int cz = FreezeTag_GridCell(origin[2]);
+
+  for (int x = cx - 1; x <= cx + 1; x++)
+    for (int y = cy - 1; y <= cy + 1; y++)
+      for (int z = cz - 1; z <= cz + 1; z++)
+        for (int16_t i = freezeTagGrid.head[FreezeTag_GridBucket(x, y, z)];
+             i != -1; i = freezeTagGrid.next[i])
+          fn(freezeTagGrid.ents[i]);
+}
+} // namespace
+
 static bool FreezeTag_CanThawTarget(gentity_t *thawer, gentity_t *frozen) {
   if (!FreezeTag_IsActive())
     return false;
@@ -1943,29 +2079,32 @@ gentity_t *worr::server::client::FreezeTag_FindFrozenTarget(gentity_t *thawer) {
   gentity_t *best = nullptr;
   float bestDot = 0.0f;
 
-  for (gentity_t *candidate : active_clients()) {
-    if (!FreezeTag_CanThawTarget(thawer, candidate))
-      continue;
+  static_assert(THAW_RANGE < FREEZETAG_GRID_CELL);
+
+  FreezeTag_ForEachNearby(thawer->s.origin, [&](gentity_t *candidate) {
+    if (candidate == best || !FreezeTag_CanThawTarget(thawer, candidate))
+      return;
 
     Vector3 toTarget = candidate->s.origin - thawer->s.origin;
     const float distance = toTarget.length();
     if (distance > THAW_RANGE)
-      continue;
+      return;
 
     Vector3 dir = toTarget.normalized();
     const float dot = dir.dot(forward);
     if (dot < 0.35f)
-      continue;
+      return;
+
+    if (best && dot <= bestDot)
+      return;
 
     if (gi.traceLine(eyeOrigin, candidate->s.origin, thawer, MASK_SHOT)
             .fraction != 1.0f)
-      continue;
+      return;
 
-    if (!best || dot > bestDot) {
-      best = candidate;
-      bestDot = dot;
-    }
-  }
+    best = candidate;
+    bestDot = dot;
+  });
 
   return best;
 }
@@ -2009,9 +2148,11 @@ static gentity_t *FreezeTag_FindNearbyThawer(gentity_t *frozen) {
   gentity_t *best = nullptr;
   float bestDistance = 0.0f;
 
-  for (gentity_t *candidate : active_clients()) {
+  static_assert(FREEZETAG_THAW_RANGE < FREEZETAG_GRID_CELL);
+
+  FreezeTag_ForEachNearby(frozen->s.origin, [&](gentity_t *candidate) {
     if (!worr::server::client::FreezeTag_IsValidThawHelper(candidate, frozen))
-      continue;
+      return;
 
     const float distance = (frozen->s.origin - candidate->s.origin).length();
 
@@ -2019,7 +2160,7 @@ static gentity_t *FreezeTag_FindNearbyThawer(gentity_t *frozen) {
       best = candidate;
       bestDistance = distance;
     }
-  }
+  });
 
   return best;
 }
@@ -2425,10 +2566,33 @@ DIE(player_die)(gentity_t *self, gentity_t *inflictor, gentity_t *attacker,
 
 /*
 ===========================
-Player_GiveStartItems
+StartItems_Parse
+
+Turns a start item list ("item [count];item [count]...") into item/count
+pairs. Lists come from g_start_items and the worldspawn key and are handed
+out on every spawn, so the parsed form is kept until the text changes;
+round-based modes respawn the whole server at once and would otherwise
+tokenize the same string for every player.
 ===========================
 */
-static void Player_GiveStartItems(gentity_t *ent, const char *input) {
+struct StartItemEntry {
+  Item *item;
+  int32_t count;
+};
+
+struct ParsedStartItems {
+  std::string source;
+  std::vector<StartItemEntry> entries;
+};
+
+static const std::vector<StartItemEntry> &StartItems_Parse(ParsedStartItems &cache,
+                                                           const char *input) {
+  if (cache.source == input)
+    return cache.entries;
+
+  cache.source = input;
+  cache.entries.clear();
+
   const char *token;
   while ((token = COM_ParseEx(&input, ";")) && *token) {
     char token_copy[MAX_TOKEN_CHARS];
@@ -2452,22 +2616,36 @@ static void Player_GiveStartItems(gentity_t *ent, const char *input) {
         count = std::clamp(strtol(count_str, nullptr, 10), 0L, 999L);
     }
 
-    if (count == 0) {
-      ent->client->pers.inventory[item->id] = 0;
+    if (count != 0 && (item->id < 0 || item->id >= MAX_ITEMS)) {
+      gi.Com_PrintFmt("Item '{}' has invalid ID {}\n", item_name,
+                      static_cast<int>(item->id));
       continue;
     }
 
-    if (item->id < 0 || item->id >= MAX_ITEMS) {
-      gi.Com_PrintFmt("Item '{}' has invalid ID {}\n", item_name,
-                      static_cast<int>(item->id));
+    cache.entries.push_back({item, count});
+  }
+
+  return cache.entries;
+}
+
+/*
+===========================
+Player_GiveStartItems
+===========================
+*/
+static void Player_GiveStartItems(gentity_t *ent, ParsedStartItems &cache,
+                                  const char *input) {
+  for (const StartItemEntry &entry : StartItems_Parse(cache, input)) {
+    if (entry.count == 0) {
+      ent->client->pers.inventory[entry.item->id] = 0;
       continue;
     }
 
     gentity_t *dummy = Spawn();
-    dummy->item = item;
-    dummy->count = count;
+    dummy->item = entry.item;
+    dummy->count = entry.count;
     dummy->spawnFlags |= SPAWNFLAG_ITEM_DROPPED;
-    item->pickup(dummy, ent);
+    entry.item->pickup(dummy, ent);
     FreeEntity(dummy);
   }
 }
@@ -2681,10 +2859,11 @@ void InitClientPersistant(gentity_t *ent, gclient_t *client) {
         }
       }
 
+      static ParsedStartItems cvarStartItems, levelStartItems;
       if (*g_start_items->string)
-        Player_GiveStartItems(ent, g_start_items->string);
+        Player_GiveStartItems(ent, cvarStartItems, g_start_items->string);
       if (level.start_items && *level.start_items)
-        Player_GiveStartItems(ent, level.start_items);
+        Player_GiveStartItems(ent, levelStartItems, level.start_items);
 
       if (!deathmatch->integer || level.matchState < MatchState::In_Progress)
         // compass also used for ready status toggling in deathmatch
@@ -2718,6 +2897,7 @@ void InitClientPersistant(gentity_t *ent, gclient_t *client) {
     ent->flags |= FL_WANTS_POWER_ARMOR;
 
   client->pers.connected = true;
+  G_RosterConnect(client);
   client->pers.spawned = true;
 
   P_RestoreFromGhostSlot(ent);
@@ -3832,6 +4012,95 @@ void ClientUserinfoChanged(gentity_t *ent, const char *userInfo) {
   service.ClientUserinfoChanged(gi, game, level, ent, userInfo);
 }
 
+/* =============
+CLIENT SLOT INDEX
+
+Social ID -> client slot, so coop reconnects do not compare every slot. Only
+ClientConnect writes sess.socialID; it re-indexes the slot there. Wholesale
+client resets (allocation, loadgame) invalidate the index, and it is
+rebuilt on the next lookup. Lookups re-check the slot's ID, so entries left
+behind by a session reset are harmless.
+============= */
+
+namespace {
+struct ClientSlotIndex {
+  std::vector<std::string> keys; // social ID indexed under, per slot
+  std::unordered_multimap<std::string, size_t> bySocial;
+  bool valid = false;
+};
+
+ClientSlotIndex clientSlotIndex;
+
+/*
+================
+ClientSlotIndex_Set
+================
+*/
+void ClientSlotIndex_Set(size_t slot, const char *socialID) {
+  std::string &key = clientSlotIndex.keys[slot];
+
+  if (key == socialID)
+    return;
+
+  if (!key.empty()) {
+    auto [first, last] = clientSlotIndex.bySocial.equal_range(key);
+    for (auto it = first; it != last; ++it) {
+      if (it->second == slot) {
+        clientSlotIndex.bySocial.erase(it);
+        break;
+      }
+    }
+  }
+
+  key = socialID;
+  if (!key.empty())
+    clientSlotIndex.bySocial.emplace(key, slot);
+}
+
+/*
+================
+ClientSlotIndex_Validate
+================
+*/
+void ClientSlotIndex_Validate() {
+  if (clientSlotIndex.valid && clientSlotIndex.keys.size() == game.maxClients)
+    return;
+
+  clientSlotIndex.bySocial.clear();
+  clientSlotIndex.keys.assign(game.maxClients, std::string{});
+
+  for (size_t i = 0; i < game.maxClients; i++)
+    ClientSlotIndex_Set(i, game.clients[i].sess.socialID);
+
+  clientSlotIndex.valid = true;
+}
+} // namespace
+
+/*
+================
+P_IndexClientSlot
+
+Records the client's current social ID in the slot index.
+================
+*/
+void P_IndexClientSlot(const gclient_t *cl) {
+  if (!clientSlotIndex.valid || !cl || !game.clients)
+    return;
+
+  const size_t slot = static_cast<size_t>(cl - game.clients);
+  if (slot < clientSlotIndex.keys.size())
+    ClientSlotIndex_Set(slot, cl->sess.socialID);
+}
+
+/*
+================
+P_InvalidateClientSlotIndex
+================
+*/
+void P_InvalidateClientSlotIndex() {
+  clientSlotIndex.valid = false;
+}
+
 static inline bool IsSlotIgnored(gentity_t *slot, gentity_t **ignore,
                                  size_t num_ignore) {
   for (size_t i = 0; i < num_ignore; i++)
@@ -3889,34 +4158,23 @@ static inline gentity_t *ClientChooseSlot_Coop(const char *userInfo,
     size_t total = 0;
   } matches[SLOT_MATCH_TYPES];
 
-  for (size_t i = 0; i < game.maxClients; i++) {
-    if (IsSlotIgnored(globals.gentities + i + 1, ignore, num_ignore) ||
-        game.clients[i].pers.connected)
-      continue;
-
-    char check_name[MAX_INFO_VALUE] = {0};
-    gi.Info_ValueForKey(game.clients[i].pers.userInfo, "name", check_name,
-                        sizeof(check_name));
-
-    bool username_match =
-        game.clients[i].pers.userInfo[0] && !strcmp(check_name, name);
-
-    bool social_match = socialID && game.clients[i].sess.socialID &&
-                        game.clients[i].sess.socialID[0] &&
-                        !strcmp(game.clients[i].sess.socialID, socialID);
+  // SLOT_MATCH_USERNAME is zero, so a slot only ever matches on its social
+  // ID; look those up in the index rather than walking every slot.
+  if (socialID && *socialID) {
+    ClientSlotIndex_Validate();
 
-    match_type_t type = (match_type_t)0;
+    auto [first, last] = clientSlotIndex.bySocial.equal_range(socialID);
+    for (auto it = first; it != last; ++it) {
+      const size_t i = it->second;
 
-    if (username_match)
-      type |= SLOT_MATCH_USERNAME;
-    if (social_match)
-      type |= SLOT_MATCH_SOCIAL;
-
-    if (!type)
-      continue;
+      if (IsSlotIgnored(globals.gentities + i + 1, ignore, num_ignore) ||
+          game.clients[i].pers.connected ||
+          strcmp(game.clients[i].sess.socialID, socialID))
+        continue;
 
-    matches[type].slot = globals.gentities + i + 1;
-    matches[type].total++;
+      matches[SLOT_MATCH_SOCIAL].slot = globals.gentities + i + 1;
+      matches[SLOT_MATCH_SOCIAL].total++;
+    }
   }
 
   // pick matches in descending order, only if the total matches
@@ -3946,6 +4204,7 @@ static inline gentity_t *ClientChooseSlot_Coop(const char *userInfo,
         matches[i].slot->sv.init = false;
         matches[i].slot->className = "player";
         matches[i].slot->client->pers.connected = true;
+        G_RosterConnect(matches[i].slot->client);
         matches[i].slot->client->pers.spawned = true;
         P_AssignClientSkinNum(matches[i].slot);
         gi.linkEntity(matches[i].slot);
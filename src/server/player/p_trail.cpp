@@ -2,14 +2,14 @@
 Licensed under the GNU General Public License 2.0.
 
 p_trail.cpp (Player Trail) This file implements a system for tracking the recent path of a
-player. It creates a trail of "breadcrumb" entities that monsters can use for pursuit even after
+player. It keeps a trail of "breadcrumb" points that monsters can use for pursuit even after
 they have lost direct line of sight to the player. Key Responsibilities: - Trail Creation: The
-`PlayerTrail_Add` function periodically drops a new trail entity at the player's location. -
-Trail Management: Manages a two-way linked list of trail entities, ensuring the trail does not
-exceed a maximum length by reusing the oldest node. - AI Pathfinding: The `PlayerTrail_Pick`
-function is used by the monster AI to find the most relevant point on a player's trail to move
-towards. - Cleanup: `PlayerTrail_Destroy` cleans up all trail entities associated with a player,
-for example, when they disconnect.*/
+`PlayerTrail_Add` function periodically drops a new trail point at the player's location, but
+only while a monster is hunting them (see `PlayerTrail_Hunted`). - Trail Management: Points are
+kept in a fixed ring inside the client, overwriting the oldest point once full. - AI
+Pathfinding: The `PlayerTrail_Pick` function is used by the monster AI to find the most relevant
+point on a player's trail to move towards. - Cleanup: `PlayerTrail_Destroy` clears the trail
+of a player, for example, when they disconnect.*/
 
 #include "../g_local.hpp"
 
@@ -20,134 +20,127 @@ PLAYER TRAIL
 
 ==============================================================================
 
-This is a two-way list containing the a list of points of where
-the player has been recently. It is used by monsters for pursuit.
+This is a ring of points of where the player has been recently.
+It is used by monsters for pursuit.
 
-This is improved from vanilla; now, the list itself is stored in
-client data so it can be stored for multiple clients.
+This is improved from vanilla; the points are stored in client
+data so they can be kept for multiple clients, and they are plain
+points rather than entities, so they cost no edicts.
 
-chain = next
-enemy = prev
+head is the next point to be written; the newest point is the
+one just before it, and walking backwards from there reaches
+the oldest of `count` valid points.
 
-The head node will always have a null "chain", the tail node
-will always have a null "enemy".
+Sampling needs a visibility trace per frame, so it is only done
+while at least one monster has this player as its enemy.
 */
 
-constexpr size_t TRAIL_LENGTH = 8;
+// how long a trail keeps sampling after the last monster
+// hunting the player stopped asking for it
+constexpr GameTime PLAYER_TRAIL_HUNTED_LINGER = 5_sec;
 
-// places a new entity at the head of the player trail.
-// the tail entity may be moved to the front if the length
-// is at the end.
-static gentity_t* PlayerTrail_Spawn(gentity_t* owner) {
-	size_t len = 0;
+// returns the n'th newest point of the trail, 0 being the head
+static inline PlayerTrailPoint& PlayerTrail_Point(gclient_t* cl, size_t n) {
+	return cl->trail.points[(cl->trail.head + PLAYER_TRAIL_LENGTH - 1 - n) % PLAYER_TRAIL_LENGTH];
+}
 
-	for (gentity_t* tail = owner->client->trail_tail; tail; tail = tail->chain)
-		len++;
+// whether the given trail point can be seen from the viewer's eyes
+static bool PlayerTrail_Visible(gentity_t* viewer, const PlayerTrailPoint& point) {
+	Vector3 eye = viewer->s.origin;
+	eye[2] += viewer->viewHeight;
 
-	gentity_t* trail;
+	return gi.traceLine(eye, point.origin, viewer, MASK_OPAQUE | CONTENTS_WINDOW).fraction == 1.0f;
+}
 
-	// move the tail to the head
-	if (len == TRAIL_LENGTH) {
-		// unlink the old tail
-		trail = owner->client->trail_tail;
-		owner->client->trail_tail = trail->chain;
-		owner->client->trail_tail->enemy = nullptr;
-		trail->chain = trail->enemy = nullptr;
-	}
-	else {
-		// spawn a new head
-		trail = Spawn();
-		trail->className = "player_trail";
+// clears the trail of the given player, or all players if null.
+// we don't want these to stay around across level loads.
+void PlayerTrail_Destroy(gentity_t* player) {
+	if (player) {
+		player->client->trail.head = player->client->trail.count = 0;
+		return;
 	}
 
-	// link as new head
-	if (owner->client->trail_head)
-		owner->client->trail_head->chain = trail;
-	trail->enemy = owner->client->trail_head;
-	owner->client->trail_head = trail;
-
-	// if there's no tail, we become the tail too
-	if (!owner->client->trail_tail)
-		owner->client->trail_tail = trail;
-
-	return trail;
+	for (auto ec : active_clients())
+		ec->client->trail.head = ec->client->trail.count = 0;
 }
 
-// destroys all player trail entities in the map.
-// we don't want these to stay around across level loads.
-void PlayerTrail_Destroy(gentity_t* player) {
-	for (size_t i = 0; i < globals.numEntities; i++)
-		if (g_entities[i].className && strcmp(g_entities[i].className, "player_trail") == 0)
-			if (!player || g_entities[i].owner == player)
-				FreeEntity(&g_entities[i]);
-
-	if (player)
-		player->client->trail_head = player->client->trail_tail = nullptr;
-	else for (auto ec : active_clients())
-		ec->client->trail_head = ec->client->trail_tail = nullptr;
+// called by monsters that have the player as their enemy,
+// keeps the player's trail sampling for a little while.
+void PlayerTrail_Hunted(gentity_t* player) {
+	if (!player->client)
+		return;
+
+	player->client->trail.huntedTime = level.time + PLAYER_TRAIL_HUNTED_LINGER;
 }
 
 // check to see if we can add a new player trail spot
 // for this player.
 void PlayerTrail_Add(gentity_t* player) {
-	// if we can still see the head, we don't want a new one.
-	if (player->client->trail_head && visible(player, player->client->trail_head))
+	gclient_t* cl = player->client;
+
+	// nobody is hunting us, so nobody will look at the trail
+	if (cl->trail.huntedTime <= level.time)
 		return;
 	// don't spawn trails in intermission, if we're dead, if we're noclipping or not on ground yet
 	else if (level.intermission.time || player->health <= 0 || player->moveType == MoveType::NoClip || player->moveType == MoveType::FreeCam ||
 		!player->groundEntity)
 		return;
+	// if we can still see the head, we don't want a new one.
+	else if (cl->trail.count && PlayerTrail_Visible(player, PlayerTrail_Point(cl, 0)))
+		return;
+
+	PlayerTrailPoint& point = cl->trail.points[cl->trail.head];
+	point.origin = player->s.oldOrigin;
+	point.time = level.time;
+	point.yaw = cl->trail.count ? vectoyaw(point.origin - PlayerTrail_Point(cl, 0).origin) : player->s.angles[YAW];
+
+	cl->trail.head = (cl->trail.head + 1) % PLAYER_TRAIL_LENGTH;
 
-	gentity_t* trail = PlayerTrail_Spawn(player);
-	trail->s.origin = player->s.oldOrigin;
-	trail->timeStamp = level.time;
-	trail->owner = player;
+	if (cl->trail.count < PLAYER_TRAIL_LENGTH)
+		cl->trail.count++;
 }
 
-// pick a trail node that matches the player
+// pick a trail point that matches the player
 // we're hunting that is visible to us.
-gentity_t* PlayerTrail_Pick(gentity_t* self, bool next) {
+const PlayerTrailPoint* PlayerTrail_Pick(gentity_t* self, bool next) {
 	// not player or doesn't have a trail yet
-	if (!self->enemy->client || !self->enemy->client->trail_head)
+	if (!self->enemy->client || !self->enemy->client->trail.count)
 		return nullptr;
 
-	// find which marker head that was dropped while we
-	// were searching for this enemy
-	gentity_t* marker;
+	gclient_t* cl = self->enemy->client;
 
-	for (marker = self->enemy->client->trail_head; marker; marker = marker->enemy) {
-		if (marker->timeStamp <= self->monsterInfo.trailTime)
-			continue;
-
-		break;
-	}
+	// the trail must have been added to while we were
+	// searching for this enemy; points are in time order,
+	// so only the head needs checking.
+	if (PlayerTrail_Point(cl, 0).time <= self->monsterInfo.trailTime)
+		return nullptr;
 
 	if (next) {
-		// find the marker we're closest to
+		// find the point we're closest to
 		float closest_dist = std::numeric_limits<float>::infinity();
-		gentity_t* closest = nullptr;
+		size_t closest = 0;
 
-		for (gentity_t* m2 = marker; m2; m2 = m2->enemy) {
-			float len = (m2->s.origin - self->s.origin).lengthSquared();
+		for (size_t i = 0; i < cl->trail.count; i++) {
+			float len = (PlayerTrail_Point(cl, i).origin - self->s.origin).lengthSquared();
 
 			if (len < closest_dist) {
 				closest_dist = len;
-				closest = m2;
+				closest = i;
 			}
 		}
 
-		// should never happen
+		// the head has no next point
 		if (!closest)
 			return nullptr;
 
 		// use the next one from the closest one
-		marker = closest->chain;
-	}
-	else {
-		// from that marker, find the first one we can see
-		for (; marker && !visible(self, marker); marker = marker->enemy)
-			continue;
+		return &PlayerTrail_Point(cl, closest - 1);
 	}
 
-	return marker;
+	// from the head, find the first one we can see
+	for (size_t i = 0; i < cl->trail.count; i++)
+		if (PlayerTrail_Visible(self, PlayerTrail_Point(cl, i)))
+			return &PlayerTrail_Point(cl, i);
+
+	return nullptr;
 }
@@ -246,6 +246,9 @@ void G_PlayerNoise(gentity_t *who, const Vector3 &where, PlayerNoise type) {
   noise->teleportTime = level.time;
 
   gi.linkEntity(noise);
+
+  // the noise is only read for a frame; parked monsters won't look that soon
+  M_WakeDormantAround(where);
 }
 
 /*
@@ -1649,10 +1652,7 @@ static void Weapon_GrenadeLauncher_Fire(gentity_t *ent) {
                fuseVel, false);
 
   // Muzzle flash
-  gi.WriteByte(svc_muzzleflash);
-  gi.WriteEntity(ent);
-  gi.WriteByte(MZ_GRENADE | isSilenced);
-  gi.multicast(ent->s.origin, MULTICAST_PVS, false);
+  G_MuzzleFlash(ent, ent->s.origin, MZ_GRENADE | isSilenced, MULTICAST_PVS);
 
   G_PlayerNoise(ent, start, PlayerNoise::Weapon);
 
@@ -1722,10 +1722,7 @@ static void Weapon_RocketLauncher_Fire(gentity_t *ent) {
   P_AddWeaponKick(ent, kickOrigin, kickAngles);
 
   // Muzzle flash
-  gi.WriteByte(svc_muzzleflash);
-  gi.WriteEntity(ent);
-  gi.WriteByte(MZ_ROCKET | isSilenced);
-  gi.multicast(ent->s.origin, MULTICAST_PVS, false);
+  G_MuzzleFlash(ent, ent->s.origin, MZ_ROCKET | isSilenced, MULTICAST_PVS);
 
   G_PlayerNoise(ent, start, PlayerNoise::Weapon);
 
@@ -2122,10 +2119,9 @@ static void Weapon_Blaster_Fire(gentity_t *ent, const Vector3 &g_offset,
                hyper ? ModID::HyperBlaster : ModID::Blaster, false);
 
   // Muzzle flash
-  gi.WriteByte(svc_muzzleflash);
-  gi.WriteEntity(ent);
-  gi.WriteByte((hyper ? MZ_HYPERBLASTER : MZ_BLASTER) | isSilenced);
-  gi.multicast(ent->s.origin, MULTICAST_PVS, false);
+  G_MuzzleFlash(ent, ent->s.origin,
+                (hyper ? MZ_HYPERBLASTER : MZ_BLASTER) | isSilenced,
+                MULTICAST_PVS);
 
   G_PlayerNoise(ent, start, PlayerNoise::Weapon);
 
@@ -2309,10 +2305,7 @@ static void Weapon_Machinegun_Fire(gentity_t *ent) {
   Weapon_PowerupSound(ent);
 
   // Muzzle flash
-  gi.WriteByte(svc_muzzleflash);
-  gi.WriteEntity(ent);
-  gi.WriteByte(MZ_MACHINEGUN | isSilenced);
-  gi.multicast(ent->s.origin, MULTICAST_PVS, false);
+  G_MuzzleFlash(ent, ent->s.origin, MZ_MACHINEGUN | isSilenced, MULTICAST_PVS);
 
   G_PlayerNoise(ent, start, PlayerNoise::Weapon);
 
@@ -2438,10 +2431,9 @@ static void Weapon_Chaingun_Fire(gentity_t *ent) {
   Weapon_PowerupSound(ent);
 
   // Muzzle flash
-  gi.WriteByte(svc_muzzleflash);
-  gi.WriteEntity(ent);
-  gi.WriteByte((MZ_CHAINGUN1 + shots - 1) | isSilenced);
-  gi.multicast(ent->s.origin, MULTICAST_PVS, false);
+  G_MuzzleFlash(ent, ent->s.origin,
+                (MZ_CHAINGUN1 + shots - 1) | isSilenced,
+                MULTICAST_PVS);
 
   G_PlayerNoise(ent, start, PlayerNoise::Weapon);
 
@@ -2500,10 +2492,7 @@ static void Weapon_Shotgun_Fire(gentity_t *ent) {
   UnLagCompensate();
 
   // Muzzle flash
-  gi.WriteByte(svc_muzzleflash);
-  gi.WriteEntity(ent);
-  gi.WriteByte(MZ_SHOTGUN | isSilenced);
-  gi.multicast(ent->s.origin, MULTICAST_PVS, false);
+  G_MuzzleFlash(ent, ent->s.origin, MZ_SHOTGUN | isSilenced, MULTICAST_PVS);
 
   // Weapon noise and stats
   G_PlayerNoise(ent, start, PlayerNoise::Weapon);
@@ -2569,10 +2558,7 @@ static void Weapon_SuperShotgun_Fire(gentity_t *ent) {
   P_AddWeaponKick(ent, ent->client->vForward * -2.f, {-2.f, 0.f, 0.f});
 
   // Visual and sound effects
-  gi.WriteByte(svc_muzzleflash);
-  gi.WriteEntity(ent);
-  gi.WriteByte(MZ_SSHOTGUN | isSilenced);
-  gi.multicast(ent->s.origin, MULTICAST_PVS, false);
+  G_MuzzleFlash(ent, ent->s.origin, MZ_SSHOTGUN | isSilenced, MULTICAST_PVS);
 
   G_PlayerNoise(ent, start, PlayerNoise::Weapon);
 
@@ -2619,10 +2605,7 @@ static void Weapon_Railgun_Fire(gentity_t *ent) {
   P_AddWeaponKick(ent, ent->client->vForward * -3.f, {-3.f, 0.f, 0.f});
 
   // Muzzle flash effect
-  gi.WriteByte(svc_muzzleflash);
-  gi.WriteEntity(ent);
-  gi.WriteByte(MZ_RAILGUN | isSilenced);
-  gi.multicast(ent->s.origin, MULTICAST_PVS, false);
+  G_MuzzleFlash(ent, ent->s.origin, MZ_RAILGUN | isSilenced, MULTICAST_PVS);
 
   G_PlayerNoise(ent, start, PlayerNoise::Weapon);
 
@@ -2658,10 +2641,7 @@ static void Weapon_BFG_Fire(gentity_t *ent) {
 
   // Show muzzle flash on windup frame only
   if (ent->client->ps.gunFrame == 9) {
-    gi.WriteByte(svc_muzzleflash);
-    gi.WriteEntity(ent);
-    gi.WriteByte(MZ_BFG | isSilenced);
-    gi.multicast(ent->s.origin, MULTICAST_PVS, false);
+    G_MuzzleFlash(ent, ent->s.origin, MZ_BFG | isSilenced, MULTICAST_PVS);
     G_PlayerNoise(ent, ent->s.origin, PlayerNoise::Weapon);
     return;
   }
@@ -2688,10 +2668,7 @@ static void Weapon_BFG_Fire(gentity_t *ent) {
   }
 
   // Fire flash
-  gi.WriteByte(svc_muzzleflash);
-  gi.WriteEntity(ent);
-  gi.WriteByte(MZ_BFG2 | isSilenced);
-  gi.multicast(ent->s.origin, MULTICAST_PVS, false);
+  G_MuzzleFlash(ent, ent->s.origin, MZ_BFG2 | isSilenced, MULTICAST_PVS);
 
   G_PlayerNoise(ent, start, PlayerNoise::Weapon);
 
@@ -2735,10 +2712,7 @@ static void Weapon_ProxLauncher_Fire(gentity_t *ent) {
   fire_prox(ent, start, dir, damageMultiplier, 600);
 
   // Muzzle flash and sound
-  gi.WriteByte(svc_muzzleflash);
-  gi.WriteEntity(ent);
-  gi.WriteByte(MZ_PROX | isSilenced);
-  gi.multicast(ent->s.origin, MULTICAST_PVS, false);
+  G_MuzzleFlash(ent, ent->s.origin, MZ_PROX | isSilenced, MULTICAST_PVS);
 
   G_PlayerNoise(ent, start, PlayerNoise::Weapon);
 
@@ -3020,10 +2994,7 @@ static void Weapon_Disruptor_Fire(gentity_t *ent) {
   fire_disruptor(ent, start, dir, damage, 1000, target);
 
   // Muzzle flash
-  gi.WriteByte(svc_muzzleflash);
-  gi.WriteEntity(ent);
-  gi.WriteByte(MZ_TRACKER | isSilenced);
-  gi.multicast(ent->s.origin, MULTICAST_PVS, false);
+  G_MuzzleFlash(ent, ent->s.origin, MZ_TRACKER | isSilenced, MULTICAST_PVS);
 
   G_PlayerNoise(ent, start, PlayerNoise::Weapon);
 
@@ -3100,10 +3071,7 @@ static void Weapon_ETF_Rifle_Fire(gentity_t *ent) {
   // Muzzle flash
   const int flashType =
       (ent->client->ps.gunFrame == 6) ? MZ_ETF_RIFLE : MZ_ETF_RIFLE_2;
-  gi.WriteByte(svc_muzzleflash);
-  gi.WriteEntity(ent);
-  gi.WriteByte(flashType | isSilenced);
-  gi.multicast(ent->s.origin, MULTICAST_PVS, false);
+  G_MuzzleFlash(ent, ent->s.origin, flashType | isSilenced, MULTICAST_PVS);
 
   G_PlayerNoise(ent, start, PlayerNoise::Weapon);
 
@@ -3193,10 +3161,7 @@ static void Weapon_PlasmaGun_Fire(gentity_t *ent) {
   gi.sound(ent, CHAN_WEAPON, gi.soundIndex("weapons/plsmfire.wav"), 1,
            ATTN_NORM, 0);
 
-  gi.WriteByte(svc_muzzleflash);
-  gi.WriteEntity(ent);
-  gi.WriteByte(MZ_HYPERBLASTER | isSilenced);
-  gi.multicast(ent->s.origin, MULTICAST_PVS, false);
+  G_MuzzleFlash(ent, ent->s.origin, MZ_HYPERBLASTER | isSilenced, MULTICAST_PVS);
 
   G_PlayerNoise(ent, start, PlayerNoise::Weapon);
   Weapon_PowerupSound(ent);
@@ -3299,10 +3264,7 @@ static void Weapon_PlasmaBeam_Fire(gentity_t *ent) {
   Weapon_PowerupSound(ent);
 
   // Muzzle flash
-  gi.WriteByte(svc_muzzleflash);
-  gi.WriteEntity(ent);
-  gi.WriteByte(MZ_HEATBEAM | isSilenced);
-  gi.multicast(ent->s.origin, MULTICAST_PVS, false);
+  G_MuzzleFlash(ent, ent->s.origin, MZ_HEATBEAM | isSilenced, MULTICAST_PVS);
 
   G_PlayerNoise(ent, start, PlayerNoise::Weapon);
 
@@ -3430,10 +3392,7 @@ static void Weapon_Thunderbolt_Fire(gentity_t *ent) {
 
   Weapon_PowerupSound(ent);
 #if 0
-	gi.WriteByte(svc_muzzleflash);
-	gi.WriteEntity(ent);
-	gi.WriteByte(MZ_ETF_RIFLE | isSilenced);
-	gi.multicast(ent->s.origin, MULTICAST_PVS, false);
+	G_MuzzleFlash(ent, ent->s.origin, MZ_ETF_RIFLE | isSilenced, MULTICAST_PVS);
 #endif
   G_PlayerNoise(ent, start, PlayerNoise::Weapon);
 
@@ -3527,10 +3486,7 @@ static void Weapon_IonRipper_Fire(gentity_t *ent) {
 
   P_AddWeaponKick(ent, ent->client->vForward * -3.f, {-3.f, 0.f, 0.f});
 
-  gi.WriteByte(svc_muzzleflash);
-  gi.WriteEntity(ent);
-  gi.WriteByte(MZ_IONRIPPER | isSilenced);
-  gi.multicast(ent->s.origin, MULTICAST_PVS, false);
+  G_MuzzleFlash(ent, ent->s.origin, MZ_IONRIPPER | isSilenced, MULTICAST_PVS);
 
   G_PlayerNoise(ent, start, PlayerNoise::Weapon);
 
@@ -3607,10 +3563,7 @@ static void Weapon_Phalanx_Fire(gentity_t *ent) {
                splashDamage);
 
   // Muzzle flash and sound
-  gi.WriteByte(svc_muzzleflash);
-  gi.WriteEntity(ent);
-  gi.WriteByte(muzzleFlashType | isSilenced);
-  gi.multicast(ent->s.origin, MULTICAST_PVS, false);
+  G_MuzzleFlash(ent, ent->s.origin, muzzleFlashType | isSilenced, MULTICAST_PVS);
 
   if (isRightBarrel) {
     ent->client->pers.match.totalShots += 2;
@@ -83,11 +83,17 @@ int main() {
 
 	GetClientConfigStore().LoadProfile(&client, playerID, playerName, gameType);
 
+	assert(GetClientConfigStore().PlayerNameForSocialID(playerID) == playerName);
+
 	Json::Value initial = LoadJson(playerPath);
 	const Json::Value::Int64 nearMax = std::numeric_limits<Json::Value::Int64>::max() - 5;
 	initial["stats"]["totalTimePlayed"] = Json::Value::Int64(nearMax);
+	initial["playerName"] = "RenamedOnDisk";
 	WriteJson(playerPath, initial);
 
+	// hand edits on disk win over the indexed copy
+	assert(GetClientConfigStore().PlayerNameForSocialID(playerID) == "RenamedOnDisk");
+
 	client.sess.skillRating = 1850;
 	client.sess.skillRatingChange = 25;
 	client.sess.playStartRealTime = 0;
@@ -0,0 +1,87 @@
+/*Copyright (c) 2024 The DarkMatter Project
+Licensed under the GNU General Public License 2.0.
+
+test_client_roster_skip.cpp implementation.*/
+
+#include <cassert>
+#include <vector>
+
+namespace std {
+	using ::sinf;
+}
+
+#include "server/g_local.hpp"
+
+GameLocals game{};
+LevelLocals level{};
+local_game_import_t gi{};
+game_export_t globals{};
+gentity_t* g_entities = nullptr;
+std::mt19937 mt_rand{};
+
+/*
+=============
+CountActiveClients
+=============
+*/
+static size_t CountActiveClients() {
+	size_t count = 0;
+	for (auto ec : active_clients()) {
+		(void)ec;
+		count++;
+	}
+	return count;
+}
+
+/*
+=============
+main
+
+Verifies that active_clients() visits slots in order, flags disconnected
+slots as it passes them and picks them up again after G_RosterConnect.
+=============
+*/
+int main() {
+	std::vector<gclient_t> clientStorage(130);
+	std::vector<gentity_t> entityStorage(clientStorage.size() + 1);
+
+	game.clients = clientStorage.data();
+	game.maxClients = static_cast<uint32_t>(clientStorage.size());
+	game.maxEntities = static_cast<uint32_t>(entityStorage.size());
+	globals.numEntities = game.maxClients + 1;
+	g_entities = entityStorage.data();
+
+	for (uint32_t i = 0; i < game.maxClients; i++) {
+		g_entities[i + 1].client = &game.clients[i];
+		g_entities[i + 1].inUse = true;
+	}
+
+	// three connected slots, spread over different skip words
+	for (uint32_t slot : { 2u, 70u, 129u })
+		game.clients[slot].pers.connected = true;
+
+	std::vector<uint32_t> seen;
+	for (auto ec : active_clients())
+		seen.push_back(static_cast<uint32_t>(ec - g_entities - 1));
+	assert((seen == std::vector<uint32_t>{ 2u, 70u, 129u }));
+
+	// everything else was flagged on the way past
+	assert(game.rosterSkip[0] == ~(1ull << 2));
+	assert(game.rosterSkip[1] == ~(1ull << 6));
+	assert((game.rosterSkip[2] & 0b11) == 0b01);
+
+	// connecting without the roster hook stays hidden...
+	game.clients[5].pers.connected = true;
+	assert(CountActiveClients() == 3);
+
+	// ...and shows up once the hook runs
+	G_RosterConnect(&game.clients[5]);
+	assert(CountActiveClients() == 4);
+
+	// disconnected-but-flagged slots are never handed out
+	game.clients[70].pers.connected = false;
+	assert(CountActiveClients() == 3);
+	assert(game.rosterSkip[1] & (1ull << 6));
+
+	return 0;
+}
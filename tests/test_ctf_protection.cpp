@@ -36,6 +36,17 @@ static trace_t BlockedTrace(const Vector3&, const Vector3&, const Vector3&, cons
 	return tr;
 }
 
+/*
+=============
+OpenPVS
+
+Reports every point as potentially visible so LocCanSee reaches its traces.
+=============
+*/
+static bool OpenPVS(const Vector3&, const Vector3&, bool) {
+	return true;
+}
+
 /*
 =============
 TestSoundIndex
@@ -55,6 +66,7 @@ Validates base defense awards when line of sight checks fail near the flag.
 int main() {
 g_entities = entities;
 gi.game_import_t::trace = BlockedTrace;
+gi.game_import_t::inPVS = OpenPVS;
 gi.soundIndex = TestSoundIndex;
 	game.clients = clients;
 	game.maxClients = 2;
@@ -14,6 +14,9 @@ void Menu::Select(gentity_t* ent) {}
 void Menu::Render(gentity_t* ent) const {}
 void Menu::EnsureCurrentVisible() {}
 
+// Client slot index lives in p_client.cpp
+void P_InvalidateClientSlotIndex() {}
+
 namespace {
 	// Mock malloc/free
 	void* MockTagMalloc(size_t size, int tag) {
@@ -168,7 +168,7 @@ int main() {
 	gi.sound = TestSound;
 	gi.positionedSound = TestPositionedSound;
 	gi.soundIndex = TestSoundIndex;
-	gi.linkEntity = TestLink;
+	gi.game_import_t::linkEntity = TestLink;
 	gi.unlinkEntity = TestUnlink;
 	gi.Bot_UnRegisterEntity = TestBotUnregister;
 	gi.Com_Error = TestComError;
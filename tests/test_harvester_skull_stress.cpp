@@ -327,7 +327,7 @@ int main()
 	gi.trace = TestTrace;
 	gi.Com_PrintFmt = TestComPrintFmt;
 	gi.setModel = TestSetModel;
-	gi.linkEntity = TestLinkEntity;
+	gi.game_import_t::linkEntity = TestLinkEntity;
 
 	const Vector3 fallback{ 0.0f, 0.0f, 0.0f };
 	const int totalRequest = 64;
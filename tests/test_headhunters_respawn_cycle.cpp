@@ -241,7 +241,7 @@ int main()
 
 	gi.modelIndex = TestModelIndex;
 	gi.setModel = TestSetModel;
-	gi.linkEntity = TestLinkEntity;
+	gi.game_import_t::linkEntity = TestLinkEntity;
 	gi.Com_PrintFmt = TestComPrintFmt;
 	gi.LocBroadcast_Print = TestLocBroadcastPrint;
 	gi.sound = TestSound;
@@ -0,0 +1,197 @@
+/*Copyright (c) 2024 The DarkMatter Project
+Licensed under the GNU General Public License 2.0.
+
+test_monster_dormant_wake.cpp implementation.*/
+
+#include "../src/server/gameplay/g_monster.cpp"
+
+#include <cassert>
+#include <vector>
+
+GameLocals game{};
+game_export_t globals{};
+LevelLocals level{};
+gentity_t* g_entities = nullptr;
+local_game_import_t gi{};
+std::mt19937 mt_rand{};
+spawn_temp_t st{};
+GameTime FRAME_TIME_S = 25_ms;
+cvar_t skill_storage{};
+cvar_t* skill = &skill_storage;
+cvar_t deathmatch_storage{};
+cvar_t* deathmatch = &deathmatch_storage;
+cvar_t coop_storage{};
+cvar_t* coop = &coop_storage;
+cvar_t g_gametype_storage{};
+cvar_t* g_gametype = &g_gametype_storage;
+cvar_t g_debug_monster_kills_storage{};
+cvar_t* g_debug_monster_kills = &g_debug_monster_kills_storage;
+cvar_t ai_allow_dm_spawn_storage{};
+cvar_t* ai_allow_dm_spawn = &ai_allow_dm_spawn_storage;
+cvar_t ai_model_scale_storage{};
+cvar_t* ai_model_scale = &ai_model_scale_storage;
+char local_game_import_t::print_buffer[0x10000];
+template<> cached_assetindex<&game_import_t::modelIndex>* cached_assetindex<&game_import_t::modelIndex>::head = nullptr;
+template<> cached_assetindex<&game_import_t::soundIndex>* cached_assetindex<&game_import_t::soundIndex>::head = nullptr;
+
+save_data_list_t::save_data_list_t(const char* name_in, save_data_tag_t tag_in, const void* ptr_in) : name(name_in), tag(tag_in), ptr(ptr_in) {}
+const save_data_list_t* save_data_list_t::fetch(const void*, save_data_tag_t) { return nullptr; }
+
+static int standCalls = 0;
+
+void ai_stand(gentity_t*, float) { standCalls++; }
+bool ClientIsPlaying(gclient_t*) { return true; }
+void Damage(gentity_t*, gentity_t*, gentity_t*, const Vector3&, const Vector3&, const Vector3&, int, int, DamageFlags, MeansOfDeath) {}
+gentity_t* Drop_Item(gentity_t*, Item*) { return nullptr; }
+gentity_t* FindEntity(gentity_t*, std::function<bool(gentity_t*)>) { return nullptr; }
+Item* FindItemByClassname(const char*) { return nullptr; }
+void FoundTarget(gentity_t*) {}
+void FreeEntity(gentity_t*) {}
+void G_AdjustPlayerScore(gclient_t*, int, bool, int) {}
+StuckResult G_FixStuckObject_Generic(Vector3&, const Vector3&, const Vector3&, std::function<trace_t(const Vector3&, const Vector3&, const Vector3&, const Vector3&)>) { return StuckResult::GoodPosition; }
+contents_t G_GetClipMask(gentity_t*) { return MASK_MONSTERSOLID; }
+void G_MonsterMuzzleFlash(gentity_t*, const Vector3&, MonsterMuzzleFlashID) {}
+void G_PlayerNoise(gentity_t*, const Vector3&, PlayerNoise) {}
+void Horde_AdjustPlayerScore(gclient_t*, int) {}
+bool KillBox(gentity_t*, bool, ModID, bool) { return true; }
+bool M_CheckAttack(gentity_t*) { return false; }
+bool M_walkmove(gentity_t*, float, float) { return true; }
+gentity_t* PickTarget(const char*) { return nullptr; }
+int Q_strncasecmp(const char*, const char*, size_t) { return 1; }
+gentity_t* Spawn() { return nullptr; }
+void UseTargets(gentity_t*, gentity_t*) {}
+bool visible(gentity_t*, gentity_t*, bool) { return true; }
+void fire_bfg(gentity_t*, const Vector3&, const Vector3&, int, int, float) {}
+void fire_blaster(gentity_t*, const Vector3&, const Vector3&, int, int, Effect, MeansOfDeath, bool) {}
+void fire_blueblaster(gentity_t*, const Vector3&, const Vector3&, int, int, Effect) {}
+void fire_bullet(gentity_t*, const Vector3&, const Vector3&, int, int, int, int, MeansOfDeath) {}
+void fire_disruptor(gentity_t*, const Vector3&, const Vector3&, int, int, gentity_t*) {}
+void fire_flechette(gentity_t*, const Vector3&, const Vector3&, int, int, int) {}
+void fire_greenblaster(gentity_t*, const Vector3&, const Vector3&, int, int, Effect, bool) {}
+void fire_grenade(gentity_t*, const Vector3&, const Vector3&, int, int, GameTime, float, float, float, bool) {}
+void fire_heat(gentity_t*, const Vector3&, const Vector3&, int, int, float, int, float) {}
+void fire_homing_pod(gentity_t*, const Vector3&, const Vector3&, int, int, MonsterMuzzleFlashID) {}
+void fire_ionripper(gentity_t*, const Vector3&, const Vector3&, int, int, Effect) {}
+void fire_plasmabeam(gentity_t*, const Vector3&, const Vector3&, const Vector3&, int, int, bool) {}
+void fire_rail(gentity_t*, const Vector3&, const Vector3&, int, int) {}
+gentity_t* fire_rocket(gentity_t*, const Vector3&, const Vector3&, int, int, float, int) { return nullptr; }
+void fire_shotgun(gentity_t*, const Vector3&, const Vector3&, int, int, int, int, int, MeansOfDeath) {}
+void pierce_trace(const Vector3&, const Vector3&, gentity_t*, pierce_args_t&, contents_t) {}
+
+/*
+=============
+TestInPHS
+
+Two rooms that can't hear each other, split at x = 1000.
+=============
+*/
+static bool TestInPHS(const Vector3& p1, const Vector3& p2, bool) {
+	return (p1.x < 1000) == (p2.x < 1000);
+}
+
+/*
+=============
+TestTrace
+
+Open space with the world as the only thing to stand on.
+=============
+*/
+static trace_t TestTrace(const Vector3&, const Vector3*, const Vector3*, const Vector3& end, const gentity_t*, contents_t) {
+	trace_t tr{};
+	tr.fraction = 1.0f;
+	tr.endPos = end;
+	tr.ent = world;
+	return tr;
+}
+
+static contents_t TestPointContents(const Vector3&) {
+	return CONTENTS_NONE;
+}
+
+static void TestLinkEntity(gentity_t*) {}
+
+static const MonsterFrame standFrames[] = {
+	{ ai_stand }, { ai_stand }, { ai_stand }, { ai_stand }
+};
+static const MonsterMove standMove = { 0, 3, standFrames, nullptr };
+
+/*
+=============
+main
+
+Parks an idle monster the shooter can't hear, then checks that an impact
+noise landing next to it wakes it and keeps it awake until its stand think
+has run.
+=============
+*/
+int main() {
+	gi.game_import_t::inPHS = TestInPHS;
+	gi.game_import_t::trace = TestTrace;
+	gi.game_import_t::pointContents = TestPointContents;
+	gi.game_import_t::linkEntity = TestLinkEntity;
+
+	std::vector<gentity_t> entities(4);
+	std::vector<gclient_t> clients(1);
+	g_entities = entities.data();
+	game.clients = clients.data();
+	game.maxClients = 1;
+	game.maxEntities = static_cast<uint32_t>(entities.size());
+	globals.numEntities = static_cast<uint32_t>(entities.size());
+
+	gentity_t* shooter = &g_entities[1];
+	shooter->inUse = true;
+	shooter->client = &game.clients[0];
+	shooter->client->pers.connected = true;
+	shooter->health = 100;
+	shooter->solid = SOLID_BBOX;
+	shooter->s.origin = { 5000, 0, 0 };
+
+	gentity_t* monster = &g_entities[2];
+	monster->inUse = true;
+	monster->svFlags = SVF_MONSTER;
+	monster->health = 100;
+	monster->groundEntity = world;
+	monster->think = monster_think;
+	monster->monsterInfo.pauseTime = HOLD_FOREVER;
+	monster->monsterInfo.active_move = &standMove;
+
+	gentity_t* noise = &g_entities[3];
+	noise->inUse = true;
+
+	// nobody can hear it: it parks
+	level.time = 1_sec;
+	monster->monsterInfo.next_move_time = level.time;
+	monster_think(monster);
+	assert(monster->monsterInfo.dormantTime == 1_sec);
+	assert(monster->nextThink == level.time + MONSTER_DORMANT_CHECK);
+	assert(standCalls == 0);
+
+	// noise in the other room leaves it alone
+	level.time += FRAME_TIME_S;
+	noise->s.origin = { 5064, 0, 0 };
+	shooter->client->sound2_entity = noise;
+	shooter->client->sound2_entity_time = level.time;
+	M_WakeDormantAround(noise->s.origin);
+	assert(monster->monsterInfo.dormantTime == 1_sec);
+
+	// the shot lands next to it, shooter still out of its PHS
+	level.time += FRAME_TIME_S;
+	noise->s.origin = { 64, 0, 0 };
+	shooter->client->sound2_entity_time = level.time;
+	M_WakeDormantAround(noise->s.origin);
+	assert(!monster->monsterInfo.dormantTime);
+	assert(monster->nextThink == level.time);
+
+	// woken a frame late, the noise is still fresh and the stand think sees it
+	level.time += FRAME_TIME_S;
+	monster_think(monster);
+	assert(!monster->monsterInfo.dormantTime);
+	assert(standCalls == 1);
+
+	// once the noise is stale it parks again
+	level.time += 1_sec;
+	monster_think(monster);
+	assert(monster->monsterInfo.dormantTime == level.time);
+
+	return 0;
+}
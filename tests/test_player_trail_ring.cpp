@@ -0,0 +1,124 @@
+/*Copyright (c) 2024 The DarkMatter Project
+Licensed under the GNU General Public License 2.0.
+
+test_player_trail_ring.cpp implementation.*/
+
+#include <cassert>
+#include <cmath>
+
+namespace std {
+	using ::sinf;
+}
+
+#include "../src/server/player/p_trail.cpp"
+
+std::mt19937 mt_rand{};
+game_export_t globals{};
+gentity_t* g_entities = nullptr;
+GameLocals game{};
+LevelLocals level{};
+local_game_import_t gi{};
+
+static int traceCount = 0;
+static bool traceBlocked = false;
+
+/*
+=============
+TestTrace
+
+Counts traces and reports either a clear or blocked line.
+=============
+*/
+static trace_t TestTrace(const Vector3&, const Vector3*, const Vector3*, const Vector3&, const gentity_t*, contents_t)
+{
+	trace_t tr{};
+	++traceCount;
+	tr.fraction = traceBlocked ? 0.5f : 1.0f;
+	return tr;
+}
+
+/*
+=============
+main
+
+Drives trail sampling and picking through the ring.
+=============
+*/
+int main()
+{
+	gi.game_import_t::trace = TestTrace;
+
+	gclient_t client{};
+	gentity_t player{};
+	gentity_t ground{};
+	player.client = &client;
+	player.health = 100;
+	player.groundEntity = &ground;
+	player.moveType = MoveType::Walk;
+
+	// nobody hunting: no sampling and no traces
+	level.time = 1_sec;
+	PlayerTrail_Add(&player);
+	assert(client.trail.count == 0);
+	assert(traceCount == 0);
+
+	// hunted: the first point needs no trace
+	PlayerTrail_Hunted(&player);
+	player.s.oldOrigin = { 0, 0, 0 };
+	PlayerTrail_Add(&player);
+	assert(client.trail.count == 1);
+	assert(traceCount == 0);
+
+	// head still visible; nothing new is dropped
+	level.time = 1100_ms;
+	player.s.oldOrigin = { 64, 0, 0 };
+	PlayerTrail_Add(&player);
+	assert(client.trail.count == 1);
+	assert(traceCount == 1);
+
+	// fill past the ring length; oldest points get overwritten
+	traceBlocked = true;
+	for (size_t i = 1; i <= PLAYER_TRAIL_LENGTH + 2; i++) {
+		level.time = 1_sec + GameTime::from_ms(100 * (i + 1));
+		player.s.oldOrigin = { 64.f * i, 0, 0 };
+		PlayerTrail_Add(&player);
+	}
+	assert(client.trail.count == PLAYER_TRAIL_LENGTH);
+	assert(PlayerTrail_Point(&client, 0).origin[0] == 64.f * (PLAYER_TRAIL_LENGTH + 2));
+	assert(PlayerTrail_Point(&client, PLAYER_TRAIL_LENGTH - 1).origin[0] == 64.f * 3);
+	assert(std::fabs(PlayerTrail_Point(&client, 0).yaw) < 0.01f);
+
+	// monster hunting the player picks the next point on from the closest one
+	gentity_t monster{};
+	monster.enemy = &player;
+	monster.s.origin = { 64.f * 5, 0, 0 };
+	monster.monsterInfo.trailTime = 0_ms;
+	const PlayerTrailPoint* next = PlayerTrail_Pick(&monster, true);
+	assert(next && next->origin[0] == 64.f * 6);
+
+	// the head has no next point
+	monster.s.origin = { 64.f * (PLAYER_TRAIL_LENGTH + 2), 0, 0 };
+	assert(!PlayerTrail_Pick(&monster, true));
+
+	// nothing visible to pick from
+	assert(!PlayerTrail_Pick(&monster, false));
+	traceBlocked = false;
+	const PlayerTrailPoint* seen = PlayerTrail_Pick(&monster, false);
+	assert(seen == &PlayerTrail_Point(&client, 0));
+
+	// trail dropped before we started searching is stale
+	monster.monsterInfo.trailTime = level.time;
+	assert(!PlayerTrail_Pick(&monster, false));
+
+	// lease runs out after the last hunt request
+	level.time += 10_sec;
+	traceBlocked = true;
+	uint8_t count = client.trail.count;
+	PlayerTrail_Add(&player);
+	assert(client.trail.count == count);
+
+	PlayerTrail_Destroy(&player);
+	assert(client.trail.count == 0 && client.trail.head == 0);
+
+	return 0;
+}
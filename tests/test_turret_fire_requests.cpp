@@ -10,7 +10,9 @@ test_turret_fire_requests.cpp implementation.*/
 #include <type_traits>
 
 GameLocals game{};
+game_export_t globals{};
 LevelLocals level{};
+gentity_t* g_entities = nullptr;
 local_game_import_t gi{};
 std::mt19937 mt_rand{};
 spawn_temp_t st{};
@@ -175,5 +177,38 @@ int main() {
 	assert(TurretConsumeFireRequest(brainBreach));
 	assert(!brainBreach->turretFireRequested);
 
+	// an idle breach settles and stops thinking
+	gentity_t* breach = AllocateEntity();
+	breach->teamMaster = breach;
+	breach->speed = 50;
+	breach->pos1 = { 30, 0, 0 };
+	breach->pos2 = { -30, 360, 0 };
+	breach->think = turret_breach_think;
+	level.time = 1_sec;
+	turret_breach_think(breach);
+	assert(!breach->nextThink);
+
+	// aiming wakes it back up
+	TurretAim(breach, { 0, 100, 0 });
+	assert(breach->nextThink == level.time + FRAME_TIME_S);
+	assert(breach->turret.aimValid);
+	assert(std::fabs(breach->moveAngles[YAW] - 90) < 0.01f);
+
+	// small drift keeps the cached solution and leaves it asleep
+	breach->nextThink = 0_ms;
+	TurretAim(breach, { 0.5f, 100, 0 });
+	assert(!breach->nextThink);
+	assert(std::fabs(breach->moveAngles[YAW] - 90) < 0.01f);
+
+	// larger drift re-solves
+	TurretAim(breach, { -100, 100, 0 });
+	assert(breach->nextThink);
+	assert(std::fabs(breach->moveAngles[YAW] - 135) < 0.01f);
+
+	// a fire request wakes a sleeping breach
+	breach->nextThink = 0_ms;
+	TurretRequestFire(breach);
+	assert(breach->nextThink);
+
 	return 0;
 }